@@ -19,6 +19,7 @@ public class HydroGrowSimulator : ModuleRules
 			"ProceduralMeshComponent",
 			"GameplayTags",
 			"NetCore",
+			"ReplicationGraph",
 			"OnlineSubsystem",
 			"OnlineSubsystemUtils"
 		});
@@ -1,5 +1,8 @@
 #include "Components/InteractionComponent.h"
 #include "Player/HydroGrowCharacter.h"
+#include "Systems/HydroponicsContainer.h"
+#include "Plants/PlantActor.h"
+#include "UObject/ObjectKey.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Kismet/KismetSystemLibrary.h"
@@ -7,6 +10,32 @@
 #include "GameFramework/Actor.h"
 #include "TimerManager.h"
 
+FInteractableClassInfo FInteractableClassInfo::Get(const UClass* Class)
+{
+	// Game thread only; a recompiled Blueprint class gets a new key and is resolved again
+	static TMap<TObjectKey<UClass>, FInteractableClassInfo> ClassInfos;
+
+	if (const FInteractableClassInfo* Info = ClassInfos.Find(Class))
+	{
+		return *Info;
+	}
+
+	FInteractableClassInfo Info;
+	if (Class->ImplementsInterface(UInteractable::StaticClass()))
+	{
+		Info.Kind = EInteractableKind::Interface;
+	}
+	else if (Class->IsChildOf<AHydroponicsContainer>())
+	{
+		Info.Kind = EInteractableKind::Container;
+	}
+	else if (Class->IsChildOf<APlantActor>())
+	{
+		Info.Kind = EInteractableKind::Plant;
+	}
+	return ClassInfos.Add(Class, Info);
+}
+
 UInteractionComponent::UInteractionComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -39,40 +68,69 @@ void UInteractionComponent::BeginPlay()
 	
 	OwnerCharacter = Cast<AHydroGrowCharacter>(GetOwner());
 	SetSphereRadius(InteractionRange * 1.2f); // Slightly larger than interaction range
+	
+	DataChangedHandle = OnInteractionDataChanged().AddUObject(this, &UInteractionComponent::HandleInteractionDataChanged);
 }
 
-void UInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	OnInteractionDataChanged().Remove(DataChangedHandle);
+	InteractionDataCache.Empty();
 	
-	if (OwnerCharacter && OwnerCharacter->IsLocallyControlled())
+	Super::EndPlay(EndPlayReason);
+}
+
+UInteractionComponent::FOnInteractionDataChanged& UInteractionComponent::OnInteractionDataChanged()
+{
+	static FOnInteractionDataChanged Delegate;
+	return Delegate;
+}
+
+void UInteractionComponent::NotifyInteractionDataChanged(AActor* Actor)
+{
+	if (Actor)
 	{
-		FindInteractables();
-		
-		AActor* NewBest = FindBestInteractable();
-		if (NewBest != BestInteractable)
-		{
-			if (BestInteractable)
-			{
-				OnInteractableLost.Broadcast(BestInteractable);
-			}
-			
-			BestInteractable = NewBest;
-			
-			if (BestInteractable)
-			{
-				OnInteractableFound.Broadcast(BestInteractable);
-			}
-		}
+		OnInteractionDataChanged().Broadcast(Actor);
 	}
+}
+
+void UInteractionComponent::HandleInteractionDataChanged(AActor* Actor)
+{
+	InteractionDataCache.Remove(Actor);
+}
+
+void UInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
-	// Update interaction progress if interacting
+	// Targets come from UInteractionQuerySubsystem; only progress is updated here
 	if (bIsInteracting)
 	{
 		UpdateInteractionProgress();
 	}
 }
 
+void UInteractionComponent::ApplyQueryResult(AActor* NewBest, TConstArrayView<AActor*> Visible)
+{
+	NearbyInteractables.Reset();
+	NearbyInteractables.Append(Visible.GetData(), Visible.Num());
+	
+	if (NewBest != BestInteractable)
+	{
+		if (BestInteractable)
+		{
+			OnInteractableLost.Broadcast(BestInteractable);
+		}
+		
+		BestInteractable = NewBest;
+		
+		if (BestInteractable)
+		{
+			OnInteractableFound.Broadcast(BestInteractable);
+		}
+	}
+}
+
 void UInteractionComponent::StartInteraction()
 {
 	if (!BestInteractable || bIsInteracting)
@@ -100,7 +158,7 @@ void UInteractionComponent::StartInteraction()
 	OnInteractionStarted.Broadcast(CurrentInteractionTarget);
 	
 	// Handle interface interaction start
-	if (CurrentInteractionTarget->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	if (FInteractableClassInfo::Get(CurrentInteractionTarget).UsesInterface())
 	{
 		IInteractable::Execute_OnInteractionStart(CurrentInteractionTarget, OwnerCharacter);
 	}
@@ -134,7 +192,7 @@ void UInteractionComponent::StopInteraction()
 	GetWorld()->GetTimerManager().ClearTimer(InteractionTimerHandle);
 	
 	// Handle interface interaction end
-	if (CurrentInteractionTarget && CurrentInteractionTarget->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	if (CurrentInteractionTarget && FInteractableClassInfo::Get(CurrentInteractionTarget).UsesInterface())
 	{
 		IInteractable::Execute_OnInteractionEnd(CurrentInteractionTarget, OwnerCharacter);
 	}
@@ -158,14 +216,8 @@ bool UInteractionComponent::CanInteractWithActor(AActor* Actor) const
 		return false;
 	}
 	
-	// Check if actor implements IInteractable interface
-	if (Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
-	{
-		return IInteractable::Execute_CanInteract(Actor, OwnerCharacter);
-	}
-	
-	// Default to true for non-interface actors
-	return true;
+	// Same rules as the character, so both always agree on what can be targeted
+	return OwnerCharacter->CanInteractWith(Actor);
 }
 
 FInteractionData UInteractionComponent::GetInteractionDataForActor(AActor* Actor) const
@@ -175,93 +227,74 @@ FInteractionData UInteractionComponent::GetInteractionDataForActor(AActor* Actor
 		return FInteractionData();
 	}
 	
-	// Check if actor implements IInteractable interface
-	if (Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	if (const FInteractionData* CachedData = InteractionDataCache.Find(Actor))
+	{
+		return *CachedData;
+	}
+	
+	FInteractionData Data;
+	if (FInteractableClassInfo::Get(Actor).UsesInterface())
+	{
+		Data = IInteractable::Execute_GetInteractionData(Actor);
+	}
+	else
 	{
-		return IInteractable::Execute_GetInteractionData(Actor);
+		// Default interaction data
+		Data.InteractionText = FString::Printf(TEXT("Interact with %s"), *Actor->GetName());
 	}
 	
-	// Return default interaction data
-	FInteractionData DefaultData;
-	DefaultData.InteractionText = FString::Printf(TEXT("Interact with %s"), *Actor->GetName());
-	return DefaultData;
+	// Destroyed actors never signal, so their entries go when the next one is added
+	for (auto It = InteractionDataCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	return InteractionDataCache.Add(Actor, Data);
 }
 
-void UInteractionComponent::FindInteractables()
+void UInteractionComponent::GatherCandidates(TArray<AActor*>& OutCandidates) const
 {
+	OutCandidates.Reset();
 	if (!OwnerCharacter)
 	{
 		return;
 	}
 	
-	NearbyInteractables.Empty();
-	
-	// Get overlapping actors
+	// Overlaps are already tracked by the sphere, so this costs no scene query
 	TArray<AActor*> OverlappingActors;
 	GetOverlappingActors(OverlappingActors);
 	
 	for (AActor* Actor : OverlappingActors)
 	{
-		if (Actor && Actor != OwnerCharacter && CanInteractWithActor(Actor))
+		if (Actor && Actor != OwnerCharacter && IsActorInInteractionCone(Actor) && CanInteractWithActor(Actor))
 		{
-			// Check if actor is in interaction cone
-			if (IsActorInInteractionCone(Actor))
-			{
-				// Check line of sight if required
-				if (!bRequireLineOfSight || HasLineOfSightToActor(Actor))
-				{
-					NearbyInteractables.Add(Actor);
-				}
-			}
+			OutCandidates.Add(Actor);
 		}
 	}
 }
 
-AActor* UInteractionComponent::FindBestInteractable()
+float UInteractionComponent::ScoreCandidate(const AActor* Actor) const
 {
-	if (NearbyInteractables.IsEmpty())
-	{
-		return nullptr;
-	}
-	
-	if (!OwnerCharacter)
+	if (!Actor || !OwnerCharacter)
 	{
-		return nullptr;
+		return -1.0f;
 	}
 	
-	AActor* Best = nullptr;
-	float BestScore = -1.0f;
-	
 	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
 	FVector CameraForward = OwnerCharacter->GetMesh()->GetForwardVector();
+	FVector ToActor = (Actor->GetActorLocation() - CharacterLocation).GetSafeNormal();
+	float Distance = FVector::Dist(CharacterLocation, Actor->GetActorLocation());
 	
-	for (AActor* Actor : NearbyInteractables)
-	{
-		if (!Actor)
-		{
-			continue;
-		}
-		
-		FVector ToActor = (Actor->GetActorLocation() - CharacterLocation).GetSafeNormal();
-		float Distance = FVector::Dist(CharacterLocation, Actor->GetActorLocation());
-		
-		// Calculate dot product (how much the actor is in front of player)
-		float DotProduct = FVector::DotProduct(CameraForward, ToActor);
-		
-		// Score based on distance and angle (closer and more centered = higher score)
-		float Score = DotProduct / (1.0f + Distance * 0.01f);
-		
-		if (Score > BestScore)
-		{
-			BestScore = Score;
-			Best = Actor;
-		}
-	}
+	// Calculate dot product (how much the actor is in front of player)
+	float DotProduct = FVector::DotProduct(CameraForward, ToActor);
 	
-	return Best;
+	// Score based on distance and angle (closer and more centered = higher score)
+	return DotProduct / (1.0f + Distance * 0.01f);
 }
 
-bool UInteractionComponent::IsActorInInteractionCone(AActor* Actor) const
+bool UInteractionComponent::IsActorInInteractionCone(const AActor* Actor) const
 {
 	if (!Actor || !OwnerCharacter)
 	{
@@ -279,30 +312,9 @@ bool UInteractionComponent::IsActorInInteractionCone(AActor* Actor) const
 	return DotProduct >= CosAngle;
 }
 
-bool UInteractionComponent::HasLineOfSightToActor(AActor* Actor) const
+FVector UInteractionComponent::GetLineOfSightOrigin() const
 {
-	if (!Actor || !OwnerCharacter)
-	{
-		return false;
-	}
-	
-	FVector StartLocation = OwnerCharacter->GetMesh()->GetComponentLocation();
-	FVector EndLocation = Actor->GetActorLocation();
-	
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwnerCharacter);
-	QueryParams.AddIgnoredActor(Actor);
-	
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		StartLocation,
-		EndLocation,
-		ECC_Visibility,
-		QueryParams
-	);
-	
-	return !bHit; // If no hit, we have line of sight
+	return OwnerCharacter ? OwnerCharacter->GetMesh()->GetComponentLocation() : GetComponentLocation();
 }
 
 void UInteractionComponent::CompleteInteraction()
@@ -313,7 +325,7 @@ void UInteractionComponent::CompleteInteraction()
 	}
 	
 	// Handle interface interaction
-	if (CurrentInteractionTarget->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	if (FInteractableClassInfo::Get(CurrentInteractionTarget).UsesInterface())
 	{
 		IInteractable::Execute_OnInteract(CurrentInteractionTarget, OwnerCharacter);
 	}
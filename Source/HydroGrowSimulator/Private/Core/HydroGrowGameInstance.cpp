@@ -32,9 +32,35 @@ void UHydroGrowGameInstance::Init()
 		bDataLoadSuccess = false;
 	}
 	
+	// Unlock catalogs follow the tables through reimports and row edits
+	RebuildPlantCatalog();
+	RebuildEquipmentCatalog();
+	if (PlantDataTable)
+	{
+		PlantTableChangedHandle = PlantDataTable->OnDataTableChanged().AddUObject(this, &UHydroGrowGameInstance::RebuildPlantCatalog);
+	}
+	if (EquipmentDataTable)
+	{
+		EquipmentTableChangedHandle = EquipmentDataTable->OnDataTableChanged().AddUObject(this, &UHydroGrowGameInstance::RebuildEquipmentCatalog);
+	}
+	
 	OnDataLoaded.Broadcast(bDataLoadSuccess);
 }
 
+void UHydroGrowGameInstance::Shutdown()
+{
+	if (PlantDataTable)
+	{
+		PlantDataTable->OnDataTableChanged().Remove(PlantTableChangedHandle);
+	}
+	if (EquipmentDataTable)
+	{
+		EquipmentDataTable->OnDataTableChanged().Remove(EquipmentTableChangedHandle);
+	}
+	
+	Super::Shutdown();
+}
+
 const FPlantSpeciesData* UHydroGrowGameInstance::GetPlantData(FName PlantID) const
 {
 	if (!PlantDataTable)
@@ -77,48 +103,126 @@ FEquipmentData UHydroGrowGameInstance::GetEquipmentDataCopy(FName EquipmentID) c
 	return FEquipmentData();
 }
 
+FPlantSpeciesHandle UHydroGrowGameInstance::FindPlantSpecies(FName PlantID) const
+{
+	FPlantSpeciesHandle Species;
+	Species.SpeciesID = PlantID;
+	Species.Index = PlantTable.Find(PlantID);
+	Species.Generation = PlantTable.GetGeneration();
+	return Species;
+}
+
+const FPlantSpeciesStats* UHydroGrowGameInstance::FindPlantStats(const FPlantSpeciesHandle& Species) const
+{
+	return PlantTable.GetStats(PlantTable.Resolve(Species.SpeciesID, Species.Index, Species.Generation));
+}
+
+const FPlantSpeciesData* UHydroGrowGameInstance::GetPlantRow(const FPlantSpeciesHandle& Species) const
+{
+	return PlantTable.GetRow(PlantTable.Resolve(Species.SpeciesID, Species.Index, Species.Generation));
+}
+
+const FPlantSpeciesStats& UHydroGrowGameInstance::GetPlantStats(const FPlantSpeciesHandle& Species) const
+{
+	static const FPlantSpeciesStats DefaultStats;
+	const FPlantSpeciesStats* Stats = FindPlantStats(Species);
+	return Stats ? *Stats : DefaultStats;
+}
+
+FText UHydroGrowGameInstance::GetPlantDisplayName(const FPlantSpeciesHandle& Species) const
+{
+	const FPlantSpeciesData* Row = GetPlantRow(Species);
+	return Row ? Row->DisplayName : FText::GetEmpty();
+}
+
+FText UHydroGrowGameInstance::GetPlantDescription(const FPlantSpeciesHandle& Species) const
+{
+	const FPlantSpeciesData* Row = GetPlantRow(Species);
+	return Row ? Row->Description : FText::GetEmpty();
+}
+
+FEquipmentHandle UHydroGrowGameInstance::FindEquipment(FName EquipmentID) const
+{
+	FEquipmentHandle Equipment;
+	Equipment.EquipmentID = EquipmentID;
+	Equipment.Index = EquipmentTable.Find(EquipmentID);
+	Equipment.Generation = EquipmentTable.GetGeneration();
+	return Equipment;
+}
+
+const FEquipmentStats* UHydroGrowGameInstance::FindEquipmentStats(const FEquipmentHandle& Equipment) const
+{
+	return EquipmentTable.GetStats(EquipmentTable.Resolve(Equipment.EquipmentID, Equipment.Index, Equipment.Generation));
+}
+
+const FEquipmentData* UHydroGrowGameInstance::GetEquipmentRow(const FEquipmentHandle& Equipment) const
+{
+	return EquipmentTable.GetRow(EquipmentTable.Resolve(Equipment.EquipmentID, Equipment.Index, Equipment.Generation));
+}
+
+const FEquipmentStats& UHydroGrowGameInstance::GetEquipmentStats(const FEquipmentHandle& Equipment) const
+{
+	static const FEquipmentStats DefaultStats;
+	const FEquipmentStats* Stats = FindEquipmentStats(Equipment);
+	return Stats ? *Stats : DefaultStats;
+}
+
+FText UHydroGrowGameInstance::GetEquipmentDisplayName(const FEquipmentHandle& Equipment) const
+{
+	const FEquipmentData* Row = GetEquipmentRow(Equipment);
+	return Row ? Row->DisplayName : FText::GetEmpty();
+}
+
+FText UHydroGrowGameInstance::GetEquipmentDescription(const FEquipmentHandle& Equipment) const
+{
+	const FEquipmentData* Row = GetEquipmentRow(Equipment);
+	return Row ? Row->Description : FText::GetEmpty();
+}
+
 TArray<FName> UHydroGrowGameInstance::GetUnlockedPlants(int32 PlayerLevel) const
 {
-	TArray<FName> UnlockedPlants;
-	
-	if (!PlantDataTable)
+	return TArray<FName>(GetUnlockedPlantIDs(PlayerLevel));
+}
+
+TArray<FName> UHydroGrowGameInstance::GetUnlockedEquipment(int32 PlayerLevel) const
+{
+	return TArray<FName>(GetUnlockedEquipmentIDs(PlayerLevel));
+}
+
+void UHydroGrowGameInstance::RebuildPlantCatalog()
+{
+	if (PlantDataTable && !PlantDataTable->GetRowStruct()->IsChildOf(FPlantSpeciesData::StaticStruct()))
 	{
-		return UnlockedPlants;
+		UE_LOG(LogTemp, Error, TEXT("Plant Data Table %s does not use FPlantSpeciesData rows"), *PlantDataTable->GetName());
+		PlantCatalog.Reset();
+		PlantTable.Build(nullptr);
+		return;
 	}
-	
-	TArray<FName> RowNames = PlantDataTable->GetRowNames();
-	for (const FName& RowName : RowNames)
+
+	PlantTable.Build(PlantDataTable);
+
+	PlantCatalog.Build(PlantDataTable, [](const uint8* Row)
 	{
-		const FPlantSpeciesData* PlantData = GetPlantData(RowName);
-		if (PlantData && PlantData->UnlockLevel <= PlayerLevel)
-		{
-			UnlockedPlants.Add(RowName);
-		}
-	}
-	
-	return UnlockedPlants;
+		return reinterpret_cast<const FPlantSpeciesData*>(Row)->UnlockLevel;
+	});
 }
 
-TArray<FName> UHydroGrowGameInstance::GetUnlockedEquipment(int32 PlayerLevel) const
+void UHydroGrowGameInstance::RebuildEquipmentCatalog()
 {
-	TArray<FName> UnlockedEquipment;
-	
-	if (!EquipmentDataTable)
+	if (EquipmentDataTable && !EquipmentDataTable->GetRowStruct()->IsChildOf(FEquipmentData::StaticStruct()))
 	{
-		return UnlockedEquipment;
+		UE_LOG(LogTemp, Error, TEXT("Equipment Data Table %s does not use FEquipmentData rows"), *EquipmentDataTable->GetName());
+		EquipmentCatalog.Reset();
+		EquipmentTable.Build(nullptr);
+		return;
 	}
-	
-	TArray<FName> RowNames = EquipmentDataTable->GetRowNames();
-	for (const FName& RowName : RowNames)
+
+	EquipmentTable.Build(EquipmentDataTable);
+
+	EquipmentCatalog.Build(EquipmentDataTable, [](const uint8* Row)
 	{
-		const FEquipmentData* EquipmentData = GetEquipmentData(RowName);
-		if (EquipmentData && EquipmentData->UnlockLevel <= PlayerLevel)
-		{
-			UnlockedEquipment.Add(RowName);
-		}
-	}
-	
-	return UnlockedEquipment;
+		return reinterpret_cast<const FEquipmentData*>(Row)->UnlockLevel;
+	});
 }
 
 bool UHydroGrowGameInstance::SaveGameData()
@@ -10,7 +10,7 @@
 
 AHydroGrowGameMode::AHydroGrowGameMode()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 	
 	PlayerControllerClass = AHydroGrowPlayerController::StaticClass();
 	DefaultPawnClass = AHydroGrowCharacter::StaticClass();
@@ -21,6 +21,7 @@ AHydroGrowGameMode::AHydroGrowGameMode()
 	Coins = 100;
 	ResearchPoints = 0;
 	EnergyCredits = 1000;
+	PendingEnergyCredits = 0.0f;
 	
 	BaseExperienceRequired = 100;
 	ExperienceScalingFactor = 1.5f;
@@ -33,6 +34,10 @@ void AHydroGrowGameMode::BeginPlay()
 	Super::BeginPlay();
 	
 	TimeManager = GetGameInstance()->GetSubsystem<UTimeManager>();
+	if (TimeManager)
+	{
+		SimulationStepHandle = TimeManager->OnSimulationStep.AddUObject(this, &AHydroGrowGameMode::UpdateEnergyCredits);
+	}
 	
 	if (!LoadGame())
 	{
@@ -40,11 +45,15 @@ void AHydroGrowGameMode::BeginPlay()
 	}
 }
 
-void AHydroGrowGameMode::Tick(float DeltaTime)
+void AHydroGrowGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	if (TimeManager && SimulationStepHandle.IsValid())
+	{
+		TimeManager->OnSimulationStep.Remove(SimulationStepHandle);
+		SimulationStepHandle.Reset();
+	}
 	
-	UpdateEnergyCredits(DeltaTime);
+	Super::EndPlay(EndPlayReason);
 }
 
 void AHydroGrowGameMode::AddExperience(int32 ExperienceAmount)
@@ -177,18 +186,23 @@ APawn* AHydroGrowGameMode::SpawnDefaultPawnFor_Implementation(AController* NewPl
 	return NewPawn;
 }
 
-void AHydroGrowGameMode::UpdateEnergyCredits(float DeltaTime)
+void AHydroGrowGameMode::UpdateEnergyCredits(const FSimulationStepContext& Step)
 {
-	// Energy credits regenerate slowly over time
-	// For now, just a simple regeneration system
-	if (TimeManager)
+	// Energy credits regenerate slowly over game time
+	const float RegenRate = 10.0f; // Credits per game hour
+	const int32 MaxEnergyCredits = DailyEnergyCredits * 2;
+	
+	if (EnergyCredits >= MaxEnergyCredits)
+	{
+		PendingEnergyCredits = 0.0f;
+		return;
+	}
+	
+	PendingEnergyCredits += RegenRate * Step.DeltaGameSeconds / 3600.0f;
+	const int32 WholeCredits = FMath::FloorToInt(PendingEnergyCredits);
+	if (WholeCredits > 0)
 	{
-		// Regenerate energy based on game time
-		float RegenRate = 10.0f; // Credits per game hour
-		float GameDeltaTime = TimeManager->GetCurrentTimeScale() * DeltaTime;
-		EnergyCredits += FMath::RoundToInt(RegenRate * GameDeltaTime / 3600.0f);
-		
-		// Cap at maximum
-		EnergyCredits = FMath::Min(EnergyCredits, DailyEnergyCredits * 2);
+		PendingEnergyCredits -= WholeCredits;
+		EnergyCredits = FMath::Min(EnergyCredits + WholeCredits, MaxEnergyCredits);
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,103 @@
+#include "Core/HydroGrowInventory.h"
+
+void FInventoryEntry::PreReplicatedRemove(const FInventoryList& InArraySerializer)
+{
+	// Removal swaps entries around, so positions in the index are no longer trustworthy
+	InArraySerializer.bIndexDirty = true;
+}
+
+void FInventoryEntry::PostReplicatedAdd(const FInventoryList& InArraySerializer)
+{
+	InArraySerializer.bIndexDirty = true;
+}
+
+int32 FInventoryList::GetQuantity(FName ItemID) const
+{
+	const int32 Index = FindStackIndex(ItemID);
+	return Index != INDEX_NONE ? Items[Index].Stack.Quantity : 0;
+}
+
+int32 FInventoryList::AddQuantity(FName ItemID, int32 Quantity, const FString& ItemType)
+{
+	if (ItemID.IsNone() || Quantity <= 0)
+	{
+		return 0;
+	}
+
+	const int32 Index = FindStackIndex(ItemID);
+	if (Index != INDEX_NONE)
+	{
+		FInventoryEntry& Entry = Items[Index];
+		Entry.Stack.Quantity += Quantity;
+		MarkItemDirty(Entry);
+		return Entry.Stack.Quantity;
+	}
+
+	const int32 NewIndex = Items.Emplace(ItemID, Quantity, ItemType);
+	StackIndex.Add(ItemID, NewIndex);
+	MarkItemDirty(Items[NewIndex]);
+	return Quantity;
+}
+
+bool FInventoryList::RemoveQuantity(FName ItemID, int32 Quantity)
+{
+	if (Quantity <= 0)
+	{
+		return false;
+	}
+
+	const int32 Index = FindStackIndex(ItemID);
+	if (Index == INDEX_NONE || Items[Index].Stack.Quantity < Quantity)
+	{
+		return false;
+	}
+
+	FInventoryEntry& Entry = Items[Index];
+	Entry.Stack.Quantity -= Quantity;
+
+	if (Entry.Stack.Quantity > 0)
+	{
+		MarkItemDirty(Entry);
+		return true;
+	}
+
+	// Drop the empty stack and patch the index of the entry swapped into its place
+	StackIndex.Remove(ItemID);
+	Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Items.IsValidIndex(Index))
+	{
+		StackIndex.Add(Items[Index].Stack.ItemID, Index);
+	}
+	MarkArrayDirty();
+	return true;
+}
+
+void FInventoryList::Reset()
+{
+	Items.Reset();
+	StackIndex.Reset();
+	bIndexDirty = false;
+	MarkArrayDirty();
+}
+
+int32 FInventoryList::FindStackIndex(FName ItemID) const
+{
+	if (bIndexDirty)
+	{
+		RebuildIndex();
+	}
+
+	const int32* Index = StackIndex.Find(ItemID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FInventoryList::RebuildIndex() const
+{
+	StackIndex.Reset();
+	StackIndex.Reserve(Items.Num());
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		StackIndex.Add(Items[i].Stack.ItemID, i);
+	}
+	bIndexDirty = false;
+}
@@ -1,10 +1,13 @@
 #include "Core/HydroGrowPlayerController.h"
 #include "Plants/PlantActor.h"
 #include "Systems/HydroponicsContainer.h"
+#include "Network/HydroGrowActionThrottle.h"
+#include "Network/HydroGrowNetworkGameMode.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
+#include "GameFramework/PlayerState.h"
 #include "DrawDebugHelpers.h"
 
 AHydroGrowPlayerController::AHydroGrowPlayerController()
@@ -20,6 +23,7 @@ AHydroGrowPlayerController::AHydroGrowPlayerController()
 	CurrentCameraDistance = 800.0f;
 	
 	CameraRotation = FRotator(-45.0f, 0.0f, 0.0f);
+	LastPredictionKey = 0;
 }
 
 void AHydroGrowPlayerController::BeginPlay()
@@ -204,6 +208,96 @@ void AHydroGrowPlayerController::OpenInventory(const FInputActionValue& Value)
 	OpenInventoryPanel();
 }
 
+void AHydroGrowPlayerController::SendContainerAction(AHydroponicsContainer* Container, FContainerActionRequest Request)
+{
+	if (!Container || !PlayerState)
+	{
+		return;
+	}
+	
+	Request.PredictionKey = ++LastPredictionKey;
+	Container->PredictAction(Request, PlayerState->GetPlayerId());
+	Server_ContainerAction(Container, Request);
+}
+
+const FString& AHydroGrowPlayerController::GetPlayerID()
+{
+	if (CachedPlayerID.IsEmpty())
+	{
+		CachedPlayerID = AHydroGrowNetworkGameMode::MakePlayerID(PlayerState);
+	}
+	return CachedPlayerID;
+}
+
+void AHydroGrowPlayerController::Server_ContainerAction_Implementation(AHydroponicsContainer* Container, const FContainerActionRequest& Request)
+{
+	// Never trust a player ID sent by the client
+	UHydroGrowActionThrottle* Throttle = UHydroGrowActionThrottle::Get(this);
+	if (!Container || !PlayerState || !Throttle)
+	{
+		Client_RejectContainerAction(Container, Request.PredictionKey);
+		return;
+	}
+	
+	// Rate limited and coalesced; the throttle acknowledges or rejects it
+	Throttle->SubmitAction(this, Container, Request, PlayerState->GetPlayerId());
+}
+
+void AHydroGrowPlayerController::Client_RejectContainerAction_Implementation(AHydroponicsContainer* Container, int32 PredictionKey)
+{
+	if (Container && PlayerState)
+	{
+		Container->RejectPrediction(PlayerState->GetPlayerId(), PredictionKey);
+	}
+}
+
+void AHydroGrowPlayerController::Server_HarvestPlant_Implementation(APlantActor* Plant)
+{
+	if (Plant)
+	{
+		Plant->HarvestFor(PlayerState);
+	}
+}
+
+void AHydroGrowPlayerController::Server_WaterPlant_Implementation(APlantActor* Plant, float WaterAmount)
+{
+	if (Plant)
+	{
+		Plant->WaterPlantFor(WaterAmount, PlayerState);
+	}
+}
+
+bool AHydroGrowPlayerController::Server_WaterPlant_Validate(APlantActor* Plant, float WaterAmount)
+{
+	return WaterAmount > 0.0f;
+}
+
+void AHydroGrowPlayerController::Server_ApplyPlantNutrients_Implementation(APlantActor* Plant, const FNutrientLevels& Nutrients)
+{
+	if (Plant)
+	{
+		Plant->ApplyNutrientsFor(Nutrients, PlayerState);
+	}
+}
+
+bool AHydroGrowPlayerController::Server_ApplyPlantNutrients_Validate(APlantActor* Plant, const FNutrientLevels& Nutrients)
+{
+	return Nutrients.IsValid();
+}
+
+void AHydroGrowPlayerController::Server_ReportDivergence_Implementation(AHydroponicsContainer* Container, int32 FirstMismatchField)
+{
+	if (Container)
+	{
+		Container->HandleDivergenceReport(PlayerState, FirstMismatchField);
+	}
+}
+
+bool AHydroGrowPlayerController::Server_ReportDivergence_Validate(AHydroponicsContainer* Container, int32 FirstMismatchField)
+{
+	return FirstMismatchField >= 0 && FirstMismatchField <= FStateDigest::MaxFields;
+}
+
 void AHydroGrowPlayerController::UpdateCameraPosition()
 {
 	if (!GetPawn()) return;
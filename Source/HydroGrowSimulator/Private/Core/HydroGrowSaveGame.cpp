@@ -10,6 +10,57 @@ UHydroGrowSaveGame::UHydroGrowSaveGame()
 	InitializeNewSave();
 }
 
+void UHydroGrowSaveGame::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	// Old layouts are recognised by their data: tagged saves omit values equal to the defaults, so
+	// files written before the current version never carry a SaveVersion below it
+	if (Ar.IsLoading())
+	{
+		UpgradeSaveData();
+	}
+}
+
+void UHydroGrowSaveGame::UpgradeSaveData()
+{
+	if (Inventory_DEPRECATED.Num() > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Upgrading save game: merging %d inventory entries into stacks"), Inventory_DEPRECATED.Num());
+
+		// Version 1 kept one entry per pickup; merge them into stacks
+		InventoryStacks.Reset();
+		for (const FInventoryItemData& Item : Inventory_DEPRECATED)
+		{
+			if (Item.ItemID.IsNone() || Item.Quantity <= 0)
+			{
+				continue;
+			}
+
+			if (FInventoryItemData* Stack = FindInventoryStack(Item.ItemID))
+			{
+				Stack->Quantity += Item.Quantity;
+			}
+			else
+			{
+				InventoryStacks.Emplace(Item.ItemID, Item.Quantity, Item.ItemType);
+			}
+		}
+		Inventory_DEPRECATED.Empty();
+	}
+
+	// A calendar clock still at its default was either absent or equal to the default ticks already
+	const int64 DeprecatedTicks = GameTime_DEPRECATED.ToTicks();
+	if (DeprecatedTicks != FGameDateTime().ToTicks())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Upgrading save game: converting calendar clock %s to ticks"), *GameTime_DEPRECATED.ToString());
+		GameTicks = DeprecatedTicks;
+		GameTime_DEPRECATED = FGameDateTime();
+	}
+
+	SaveVersion = CURRENT_SAVE_VERSION;
+}
+
 void UHydroGrowSaveGame::InitializeNewSave()
 {
 	// Initialize player progress
@@ -20,7 +71,7 @@ void UHydroGrowSaveGame::InitializeNewSave()
 	EnergyCredits = 1000;
 	
 	// Initialize game state
-	GameTime = FGameDateTime();
+	GameTicks = FGameDateTime().ToTicks();
 	TimeMode = EGameTimeMode::Normal;
 	RealTimeSaved = FDateTime::Now();
 	TotalPlayTimeHours = 0.0f;
@@ -30,7 +81,7 @@ void UHydroGrowSaveGame::InitializeNewSave()
 	Plants.Empty();
 	
 	// Initialize inventory
-	Inventory.Empty();
+	InventoryStacks.Empty();
 	SeedInventory.Empty();
 	EquipmentInventory.Empty();
 	
@@ -117,20 +168,15 @@ void UHydroGrowSaveGame::AddInventoryItem(FName ItemID, int32 Quantity, const FS
 		return;
 	}
 	
-	// Check if item already exists
-	for (FInventoryItemData& Item : Inventory)
+	if (FInventoryItemData* Stack = FindInventoryStack(ItemID))
 	{
-		if (Item.ItemID == ItemID && Item.ItemType == ItemType)
-		{
-			Item.Quantity += Quantity;
-			UE_LOG(LogTemp, Log, TEXT("Added %d %s to inventory (total: %d)"), 
-				Quantity, *ItemID.ToString(), Item.Quantity);
-			return;
-		}
+		Stack->Quantity += Quantity;
+		UE_LOG(LogTemp, Log, TEXT("Added %d %s to inventory (total: %d)"), 
+			Quantity, *ItemID.ToString(), Stack->Quantity);
+		return;
 	}
 	
-	// Add new item
-	Inventory.Add(FInventoryItemData(ItemID, Quantity, ItemType));
+	InventoryStacks.Emplace(ItemID, Quantity, ItemType);
 	UE_LOG(LogTemp, Log, TEXT("Added new item to inventory: %d %s"), 
 		Quantity, *ItemID.ToString());
 }
@@ -142,47 +188,40 @@ bool UHydroGrowSaveGame::RemoveInventoryItem(FName ItemID, int32 Quantity)
 		return false;
 	}
 	
-	for (int32 i = 0; i < Inventory.Num(); i++)
+	FInventoryItemData* Stack = FindInventoryStack(ItemID);
+	if (!Stack)
 	{
-		if (Inventory[i].ItemID == ItemID)
-		{
-			if (Inventory[i].Quantity >= Quantity)
-			{
-				Inventory[i].Quantity -= Quantity;
-				
-				// Remove item if quantity reaches zero
-				if (Inventory[i].Quantity == 0)
-				{
-					Inventory.RemoveAt(i);
-				}
-				
-				UE_LOG(LogTemp, Log, TEXT("Removed %d %s from inventory"), 
-					Quantity, *ItemID.ToString());
-				return true;
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Not enough %s in inventory (has %d, needs %d)"), 
-					*ItemID.ToString(), Inventory[i].Quantity, Quantity);
-				return false;
-			}
-		}
+		UE_LOG(LogTemp, Warning, TEXT("Item %s not found in inventory"), *ItemID.ToString());
+		return false;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("Item %s not found in inventory"), *ItemID.ToString());
-	return false;
+	if (Stack->Quantity < Quantity)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Not enough %s in inventory (has %d, needs %d)"), 
+			*ItemID.ToString(), Stack->Quantity, Quantity);
+		return false;
+	}
+	
+	Stack->Quantity -= Quantity;
+	if (Stack->Quantity == 0)
+	{
+		InventoryStacks.RemoveAll([ItemID](const FInventoryItemData& Entry) { return Entry.ItemID == ItemID; });
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("Removed %d %s from inventory"), 
+		Quantity, *ItemID.ToString());
+	return true;
 }
 
 int32 UHydroGrowSaveGame::GetInventoryItemCount(FName ItemID) const
 {
-	for (const FInventoryItemData& Item : Inventory)
-	{
-		if (Item.ItemID == ItemID)
-		{
-			return Item.Quantity;
-		}
-	}
-	return 0;
+	const FInventoryItemData* Stack = InventoryStacks.FindByPredicate([ItemID](const FInventoryItemData& Entry) { return Entry.ItemID == ItemID; });
+	return Stack ? Stack->Quantity : 0;
+}
+
+FInventoryItemData* UHydroGrowSaveGame::FindInventoryStack(FName ItemID)
+{
+	return InventoryStacks.FindByPredicate([ItemID](const FInventoryItemData& Stack) { return Stack.ItemID == ItemID; });
 }
 
 void UHydroGrowSaveGame::UnlockPlant(FName PlantID)
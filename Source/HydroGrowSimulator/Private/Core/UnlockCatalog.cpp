@@ -0,0 +1,65 @@
+#include "Core/UnlockCatalog.h"
+#include "Engine/DataTable.h"
+#include "Algo/StableSort.h"
+
+void FUnlockCatalog::Reset()
+{
+	RowNames.Reset();
+	LevelEnds.Reset();
+	FirstLevel = 0;
+}
+
+void FUnlockCatalog::Build(const UDataTable* Table, TFunctionRef<int32(const uint8* Row)> GetUnlockLevel)
+{
+	Reset();
+	if (!Table)
+	{
+		return;
+	}
+
+	TArray<TPair<int32, FName>> Rows;
+	Rows.Reserve(Table->GetRowMap().Num());
+	for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+	{
+		Rows.Emplace(GetUnlockLevel(Row.Value), Row.Key);
+	}
+
+	Algo::StableSortBy(Rows, [](const TPair<int32, FName>& Row) { return Row.Key; });
+
+	RowNames.Reserve(Rows.Num());
+	for (const TPair<int32, FName>& Row : Rows)
+	{
+		RowNames.Add(Row.Value);
+	}
+
+	if (Rows.Num() == 0)
+	{
+		return;
+	}
+
+	// One boundary per level between the lowest and highest unlock level
+	FirstLevel = Rows[0].Key;
+	const int32 LastLevel = Rows.Last().Key;
+	LevelEnds.SetNumUninitialized(LastLevel - FirstLevel + 1);
+
+	int32 RowIndex = 0;
+	for (int32 Level = FirstLevel; Level <= LastLevel; Level++)
+	{
+		while (RowIndex < Rows.Num() && Rows[RowIndex].Key <= Level)
+		{
+			RowIndex++;
+		}
+		LevelEnds[Level - FirstLevel] = RowIndex;
+	}
+}
+
+TConstArrayView<FName> FUnlockCatalog::GetUnlocked(int32 PlayerLevel) const
+{
+	if (LevelEnds.Num() == 0 || PlayerLevel < FirstLevel)
+	{
+		return TConstArrayView<FName>();
+	}
+
+	const int32 LevelIndex = FMath::Min(PlayerLevel - FirstLevel, LevelEnds.Num() - 1);
+	return TConstArrayView<FName>(RowNames.GetData(), LevelEnds[LevelIndex]);
+}
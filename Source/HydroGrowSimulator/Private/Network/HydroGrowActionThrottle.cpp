@@ -0,0 +1,218 @@
+#include "Network/HydroGrowActionThrottle.h"
+#include "Core/HydroGrowPlayerController.h"
+#include "Systems/HydroponicsContainer.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "TimerManager.h"
+
+static FAutoConsoleCommandWithWorldAndArgs ThrottleStatsCommand(
+	TEXT("HydroGrow.Net.ThrottleStats"),
+	TEXT("Print how many client container actions were applied, coalesced and dropped"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UHydroGrowActionThrottle* Throttle = UHydroGrowActionThrottle::Get(World))
+		{
+			const FActionThrottleStats& Stats = Throttle->GetStats();
+			UE_LOG(LogTemp, Display, TEXT("Container actions: %d applied, %d coalesced, %d dropped"),
+				Stats.Applied, Stats.Coalesced, Stats.Dropped);
+		}
+	}));
+
+UHydroGrowActionThrottle::UHydroGrowActionThrottle()
+{
+	CoalesceWindow = 0.1f;
+	TokensPerSecond = 10.0f;
+	TokenBurst = 20.0f;
+}
+
+UHydroGrowActionThrottle* UHydroGrowActionThrottle::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UHydroGrowActionThrottle>() : nullptr;
+}
+
+bool UHydroGrowActionThrottle::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHydroGrowActionThrottle::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(FlushTimer);
+	}
+
+	Windows.Empty();
+	Buckets.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHydroGrowActionThrottle::IsCoalescable(EContainerAction Action)
+{
+	// Absolute settings, where only the last value of a burst matters
+	return Action == EContainerAction::SetPHLevel || Action == EContainerAction::SetECLevel;
+}
+
+void UHydroGrowActionThrottle::SubmitAction(AHydroGrowPlayerController* Controller, AHydroponicsContainer* Container, const FContainerActionRequest& Request, int32 PlayerId)
+{
+	if (!Controller || !Container)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetRealTimeSeconds();
+	const bool bCoalescable = IsCoalescable(Request.Action);
+
+	if (FCoalesceWindow* Window = Windows.Find(Controller))
+	{
+		// Another adjustment of the same setting: replace the pending value and answer when the window closes
+		if (bCoalescable && Now < Window->EndTime && Window->Container == Container && Window->Pending.Action == Request.Action)
+		{
+			Window->Pending = Request;
+			Window->PlayerId = PlayerId;
+			Window->WaitingKeys.Add(Request.PredictionKey);
+			return;
+		}
+
+		// Anything else ends the run; apply what it held first so the player's actions stay in order
+		ApplyPending(Controller, *Window, Now);
+		Windows.Remove(Controller);
+	}
+
+	if (!TryConsumeToken(Controller, Now))
+	{
+		Stats.Dropped++;
+		UE_LOG(LogTemp, Verbose, TEXT("Dropped %s from player %d: rate limited"), *UEnum::GetValueAsString(Request.Action), PlayerId);
+		Controller->Client_RejectContainerAction(Container, Request.PredictionKey);
+		return;
+	}
+
+	ApplyAction(Controller, Container, Request, PlayerId, MakeArrayView(&Request.PredictionKey, 1));
+
+	if (bCoalescable)
+	{
+		FCoalesceWindow& Window = Windows.Add(Controller);
+		Window.Container = Container;
+		Window.PlayerId = PlayerId;
+		Window.EndTime = Now + CoalesceWindow;
+		Window.Pending = Request;
+		ScheduleFlush();
+	}
+}
+
+bool UHydroGrowActionThrottle::TryConsumeToken(AHydroGrowPlayerController* Controller, double Now)
+{
+	FTokenBucket* Bucket = Buckets.Find(Controller);
+	if (!Bucket)
+	{
+		// New player: forget the buckets of players who have left
+		for (auto It = Buckets.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		Bucket = &Buckets.Add(Controller);
+		Bucket->Tokens = TokenBurst;
+		Bucket->LastRefillTime = Now;
+	}
+
+	Bucket->Tokens = FMath::Min(TokenBurst, Bucket->Tokens + static_cast<float>(Now - Bucket->LastRefillTime) * TokensPerSecond);
+	Bucket->LastRefillTime = Now;
+
+	if (Bucket->Tokens < 1.0f)
+	{
+		return false;
+	}
+
+	Bucket->Tokens -= 1.0f;
+	return true;
+}
+
+void UHydroGrowActionThrottle::ApplyAction(AHydroGrowPlayerController* Controller, AHydroponicsContainer* Container, const FContainerActionRequest& Request, int32 PlayerId, TConstArrayView<int32> PredictionKeys)
+{
+	const bool bAccepted = Container->ExecuteAction(Request, Controller->GetPlayerID(), PlayerId);
+
+	if (bAccepted)
+	{
+		Stats.Applied++;
+
+		// Replicates with the new state; the keys arrive in order, so the last one covers the rest
+		Container->AcknowledgePredictions(PlayerId, PredictionKeys.Last());
+		return;
+	}
+
+	for (const int32 PredictionKey : PredictionKeys)
+	{
+		Controller->Client_RejectContainerAction(Container, PredictionKey);
+	}
+}
+
+void UHydroGrowActionThrottle::ScheduleFlush()
+{
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (!TimerManager.IsTimerActive(FlushTimer))
+	{
+		TimerManager.SetTimer(FlushTimer, this, &UHydroGrowActionThrottle::FlushWindows, CoalesceWindow, true);
+	}
+}
+
+bool UHydroGrowActionThrottle::ApplyPending(AHydroGrowPlayerController* Controller, FCoalesceWindow& Window, double Now)
+{
+	AHydroponicsContainer* Container = Window.Container.Get();
+	if (Window.WaitingKeys.Num() == 0 || !Controller || !Container)
+	{
+		return false;
+	}
+
+	const TArray<int32> WaitingKeys = MoveTemp(Window.WaitingKeys);
+	Window.WaitingKeys.Reset();
+
+	if (!TryConsumeToken(Controller, Now))
+	{
+		Stats.Dropped += WaitingKeys.Num();
+		for (const int32 PredictionKey : WaitingKeys)
+		{
+			Controller->Client_RejectContainerAction(Container, PredictionKey);
+		}
+		return false;
+	}
+
+	// One update for the whole burst
+	Stats.Coalesced += WaitingKeys.Num() - 1;
+	ApplyAction(Controller, Container, Window.Pending, Window.PlayerId, WaitingKeys);
+	return true;
+}
+
+void UHydroGrowActionThrottle::FlushWindows()
+{
+	const double Now = GetWorld()->GetRealTimeSeconds();
+
+	for (auto It = Windows.CreateIterator(); It; ++It)
+	{
+		FCoalesceWindow& Window = It.Value();
+		if (Now < Window.EndTime)
+		{
+			continue;
+		}
+
+		// Keep the window open while the player is still adjusting
+		if (ApplyPending(It.Key().Get(), Window, Now))
+		{
+			Window.EndTime = Now + CoalesceWindow;
+		}
+		else
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (Windows.Num() == 0)
+	{
+		GetWorld()->GetTimerManager().ClearTimer(FlushTimer);
+	}
+}
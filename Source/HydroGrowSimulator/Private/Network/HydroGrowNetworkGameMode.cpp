@@ -15,7 +15,7 @@ AHydroGrowNetworkGameMode::AHydroGrowNetworkGameMode()
 	PlayerStateClass = AHydroGrowNetworkPlayerState::StaticClass();
 	
 	// Network settings
-	MaxPlayers = 4;
+	MaxPlayers = 32;
 	bRequireInvitation = false;
 	bAllowVisitors = true;
 	SessionTimeoutMinutes = 60.0f;
@@ -345,13 +345,16 @@ void AHydroGrowNetworkGameMode::UpdatePlayerContributionScore(const FString& Pla
 	}
 }
 
+FString AHydroGrowNetworkGameMode::MakePlayerID(const APlayerState* PlayerState)
+{
+	return PlayerState ? FString::Printf(TEXT("%d_%s"), PlayerState->GetPlayerId(), *PlayerState->GetPlayerName()) : FString();
+}
+
 FString AHydroGrowNetworkGameMode::GeneratePlayerID(APlayerController* PlayerController) const
 {
 	if (PlayerController && PlayerController->GetPlayerState<APlayerState>())
 	{
-		return FString::Printf(TEXT("%d_%s"), 
-			PlayerController->GetPlayerState<APlayerState>()->GetPlayerId(),
-			*PlayerController->GetPlayerState<APlayerState>()->GetPlayerName());
+		return MakePlayerID(PlayerController->GetPlayerState<APlayerState>());
 	}
 	return TEXT("Unknown");
 }
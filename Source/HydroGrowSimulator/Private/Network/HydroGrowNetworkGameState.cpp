@@ -1,6 +1,7 @@
 #include "Network/HydroGrowNetworkGameState.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
 
 AHydroGrowNetworkGameState::AHydroGrowNetworkGameState()
 {
@@ -8,6 +9,10 @@ AHydroGrowNetworkGameState::AHydroGrowNetworkGameState()
 	bReplicates = true;
 	bAlwaysRelevant = true;
 	
+	// The server checks the shared clock against the time manager a few times a second
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickInterval = 0.5f;
+	
 	// Initialize shared resources
 	SharedCoins = 100;
 	SharedResearchPoints = 0;
@@ -16,12 +21,15 @@ AHydroGrowNetworkGameState::AHydroGrowNetworkGameState()
 	// Initialize session info
 	SessionStartTime = FDateTime::Now();
 	bIsPrivateSession = false;
-	MaxPlayers = 4;
+	MaxPlayers = 32;
 	SessionName = TEXT("HydroGrow Garden");
 	
 	// Initialize shared time
-	SharedGameTime = FGameDateTime();
+	SharedGameTicks = FGameDateTime().ToTicks();
 	SharedTimeMode = EGameTimeMode::Normal;
+	SharedTimeScale = 0.0f;
+	SharedTimeAnchorSeconds = 0.0;
+	SharedTimeMaxDriftSeconds = 30.0f;
 }
 
 void AHydroGrowNetworkGameState::BeginPlay()
@@ -39,8 +47,10 @@ void AHydroGrowNetworkGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProp
 	DOREPLIFETIME(AHydroGrowNetworkGameState, ConnectedPlayers);
 	DOREPLIFETIME(AHydroGrowNetworkGameState, ChatHistory);
 	DOREPLIFETIME(AHydroGrowNetworkGameState, ActionHistory);
-	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedGameTime);
+	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedGameTicks);
 	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedTimeMode);
+	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedTimeScale);
+	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedTimeAnchorSeconds);
 	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedCoins);
 	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedResearchPoints);
 	DOREPLIFETIME(AHydroGrowNetworkGameState, SharedEnergyCredits);
@@ -63,12 +73,50 @@ void AHydroGrowNetworkGameState::UpdateSharedResources(int32 Coins, int32 Resear
 	}
 }
 
-void AHydroGrowNetworkGameState::UpdateSharedTime(const FGameDateTime& NewTime, EGameTimeMode NewMode)
+void AHydroGrowNetworkGameState::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+	
+	if (HasAuthority())
+	{
+		SyncSharedTime();
+	}
+}
+
+int64 AHydroGrowNetworkGameState::GetSharedGameTicks() const
+{
+	const double Elapsed = FMath::Max(GetServerWorldTimeSeconds() - SharedTimeAnchorSeconds, 0.0);
+	return SharedGameTicks + static_cast<int64>(Elapsed * SharedTimeScale * FGameDateTime::TicksPerSecond);
+}
+
+void AHydroGrowNetworkGameState::SyncSharedTime()
+{
+	const UTimeManager* TimeManager = GetGameInstance() ? GetGameInstance()->GetSubsystem<UTimeManager>() : nullptr;
+	if (!TimeManager)
+	{
+		return;
+	}
+	
+	// Extrapolation covers steady running; skips, offline catch-up and backlog slowdowns show up as drift
+	const int64 GameTicks = TimeManager->GetGameTicks();
+	const float TimeScale = TimeManager->GetCurrentTimeScale();
+	const int64 MaxDriftTicks = static_cast<int64>(SharedTimeMaxDriftSeconds * FGameDateTime::TicksPerSecond);
+	
+	if (TimeManager->GetCurrentTimeMode() != SharedTimeMode || TimeScale != SharedTimeScale
+		|| FMath::Abs(GetSharedGameTicks() - GameTicks) > MaxDriftTicks)
+	{
+		UpdateSharedTime(GameTicks, TimeManager->GetCurrentTimeMode(), TimeScale);
+	}
+}
+
+void AHydroGrowNetworkGameState::UpdateSharedTime(int64 NewGameTicks, EGameTimeMode NewMode, float NewTimeScale)
 {
 	if (HasAuthority())
 	{
-		SharedGameTime = NewTime;
+		SharedGameTicks = NewGameTicks;
 		SharedTimeMode = NewMode;
+		SharedTimeScale = NewTimeScale;
+		SharedTimeAnchorSeconds = GetServerWorldTimeSeconds();
 		
 		// Trigger replication
 		OnRep_SharedTime();
@@ -158,6 +206,7 @@ void AHydroGrowNetworkGameState::OnRep_ActionHistory()
 void AHydroGrowNetworkGameState::OnRep_SharedTime()
 {
 	// Broadcast time change
+	const FGameDateTime SharedGameTime = GetSharedGameTime();
 	OnSharedTimeChanged.Broadcast(SharedGameTime, SharedTimeMode);
 	
 	UE_LOG(LogTemp, Log, TEXT("Shared time updated: %s (Mode: %s)"), 
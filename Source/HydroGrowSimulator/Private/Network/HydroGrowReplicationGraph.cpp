@@ -0,0 +1,239 @@
+#include "Network/HydroGrowReplicationGraph.h"
+#include "Network/HydroGrowNetworkGameMode.h"
+#include "Systems/HydroponicsContainer.h"
+#include "Plants/PlantActor.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Info.h"
+#include "UObject/UObjectIterator.h"
+
+void UHydroGrowReplicationGraphNode_OwnedContainers::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	// Controller, pawn and view target
+	Super::GatherActorListsForConnection(Params);
+
+	if (Params.ReplicationFrameNum >= NextRefreshFrame)
+	{
+		NextRefreshFrame = Params.ReplicationFrameNum + RefreshIntervalFrames;
+		OwnedContainers.Reset();
+
+		FString PlayerID;
+		for (const FNetViewer& Viewer : Params.Viewers)
+		{
+			const APlayerController* PC = Cast<APlayerController>(Viewer.InViewer);
+			if (PC && PC->PlayerState)
+			{
+				PlayerID = AHydroGrowNetworkGameMode::MakePlayerID(PC->PlayerState);
+				break;
+			}
+		}
+
+		UHydroGrowReplicationGraph* Graph = CastChecked<UHydroGrowReplicationGraph>(GetOuter());
+		TArray<TWeakObjectPtr<AHydroponicsContainer>> PreviouslyBoosted = MoveTemp(BoostedContainers);
+		BoostedContainers.Reset();
+
+		if (!PlayerID.IsEmpty())
+		{
+			for (const TWeakObjectPtr<AHydroponicsContainer>& Container : Graph->GetContainers())
+			{
+				if (Container.IsValid() && Container->GetOwnerPlayerID() == PlayerID)
+				{
+					OwnedContainers.Add(Container.Get());
+					BoostedContainers.Add(Container);
+					Graph->SetOwnerSettings(Params.ConnectionManager, Container.Get(), true);
+				}
+			}
+		}
+
+		// Containers that changed hands go back to their class settings on this connection
+		for (const TWeakObjectPtr<AHydroponicsContainer>& Container : PreviouslyBoosted)
+		{
+			if (Container.IsValid() && !BoostedContainers.Contains(Container))
+			{
+				Graph->SetOwnerSettings(Params.ConnectionManager, Container.Get(), false);
+			}
+		}
+	}
+
+	if (OwnedContainers.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(OwnedContainers);
+	}
+}
+
+UHydroGrowReplicationGraph::UHydroGrowReplicationGraph()
+{
+	SpatialCellSize = 10000.0f;
+	SpatialBias = FVector2D(-150000.0f, -200000.0f);
+	OwnedContainerReplicationPeriodFrame = 1;
+	GridNode = nullptr;
+	AlwaysRelevantNode = nullptr;
+	PlayerStateNode = nullptr;
+}
+
+void UHydroGrowReplicationGraph::ResetGameWorldState()
+{
+	Super::ResetGameWorldState();
+
+	Containers.Reset();
+}
+
+void UHydroGrowReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	ClassRepNodePolicies.Set(AHydroponicsContainer::StaticClass(), EHydroGrowRepNodeMapping::Spatialize_Static);
+	ClassRepNodePolicies.Set(APlantActor::StaticClass(), EHydroGrowRepNodeMapping::Spatialize_Static);
+	ClassRepNodePolicies.Set(APawn::StaticClass(), EHydroGrowRepNodeMapping::Spatialize_Dynamic);
+	ClassRepNodePolicies.Set(AInfo::StaticClass(), EHydroGrowRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), EHydroGrowRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), EHydroGrowRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), EHydroGrowRepNodeMapping::NotRouted);
+
+	// Replication period and cull distance per replicated class, taken from its defaults
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject(false));
+		if (!ActorCDO || !ActorCDO->GetIsReplicated())
+		{
+			continue;
+		}
+
+		// Skip blueprint compilation leftovers
+		const FString ClassName = Class->GetName();
+		if (ClassName.StartsWith(TEXT("SKEL_")) || ClassName.StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const EHydroGrowRepNodeMapping Policy = GetMappingPolicy(Class);
+		const bool bSpatialize = Policy == EHydroGrowRepNodeMapping::Spatialize_Static || Policy == EHydroGrowRepNodeMapping::Spatialize_Dynamic;
+
+		FClassReplicationInfo ClassInfo;
+		InitClassReplicationInfo(ClassInfo, Class, bSpatialize);
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+	}
+}
+
+void UHydroGrowReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, const UClass* Class, bool bSpatialize) const
+{
+	const AActor* ActorCDO = CastChecked<AActor>(Class->GetDefaultObject());
+	if (bSpatialize)
+	{
+		Info.SetCullDistanceSquared(ActorCDO->GetNetCullDistanceSquared());
+	}
+
+	Info.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(ActorCDO->GetNetUpdateFrequency());
+}
+
+void UHydroGrowReplicationGraph::SetOwnerSettings(UNetReplicationGraphConnection& Connection, AHydroponicsContainer* Container, bool bOwned)
+{
+	FConnectionReplicationActorInfo& ConnectionInfo = Connection.ActorInfoMap.FindOrAdd(Container);
+	if (bOwned)
+	{
+		// A cull distance of zero disables distance culling for this connection
+		ConnectionInfo.SetCullDistanceSquared(0.0f);
+		ConnectionInfo.ReplicationPeriodFrame = FMath::Max(OwnedContainerReplicationPeriodFrame, 1);
+	}
+	else
+	{
+		const FGlobalActorReplicationInfo& GlobalInfo = GlobalActorReplicationInfoMap.Get(Container);
+		ConnectionInfo.SetCullDistanceSquared(GlobalInfo.Settings.GetCullDistanceSquared());
+		ConnectionInfo.ReplicationPeriodFrame = GlobalInfo.Settings.ReplicationPeriodFrame;
+	}
+}
+
+EHydroGrowRepNodeMapping UHydroGrowReplicationGraph::GetMappingPolicy(const UClass* Class)
+{
+	if (const EHydroGrowRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+	{
+		return *Policy;
+	}
+
+	// Classes without an explicit policy keep their legacy relevancy flags
+	const AActor* ActorCDO = CastChecked<AActor>(Class->GetDefaultObject());
+	EHydroGrowRepNodeMapping Policy = EHydroGrowRepNodeMapping::Spatialize_Dynamic;
+	if (ActorCDO->bAlwaysRelevant)
+	{
+		Policy = EHydroGrowRepNodeMapping::RelevantAllConnections;
+	}
+	else if (ActorCDO->bOnlyRelevantToOwner)
+	{
+		Policy = EHydroGrowRepNodeMapping::NotRouted;
+	}
+
+	ClassRepNodePolicies.Set(Class, Policy);
+	return Policy;
+}
+
+void UHydroGrowReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = SpatialCellSize;
+	GridNode->SpatialBias = SpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	// Rate limits player state updates as the player count grows
+	PlayerStateNode = CreateNewNode<UReplicationGraphNode_PlayerStateFrequencyLimiter>();
+	AddGlobalGraphNode(PlayerStateNode);
+}
+
+void UHydroGrowReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UHydroGrowReplicationGraphNode_OwnedContainers* OwnedNode = CreateNewNode<UHydroGrowReplicationGraphNode_OwnedContainers>();
+	AddConnectionGraphNode(OwnedNode, RepGraphConnection);
+}
+
+void UHydroGrowReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EHydroGrowRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case EHydroGrowRepNodeMapping::Spatialize_Static:
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+	case EHydroGrowRepNodeMapping::Spatialize_Dynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	default:
+		break;
+	}
+
+	if (AHydroponicsContainer* Container = Cast<AHydroponicsContainer>(ActorInfo.GetActor()))
+	{
+		Containers.Add(Container);
+	}
+}
+
+void UHydroGrowReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EHydroGrowRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case EHydroGrowRepNodeMapping::Spatialize_Static:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+	case EHydroGrowRepNodeMapping::Spatialize_Dynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	default:
+		break;
+	}
+
+	if (AHydroponicsContainer* Container = Cast<AHydroponicsContainer>(ActorInfo.GetActor()))
+	{
+		Containers.RemoveSwap(Container);
+	}
+}
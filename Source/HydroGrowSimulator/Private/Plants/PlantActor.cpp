@@ -3,18 +3,166 @@
 #include "Core/HydroGrowGameInstance.h"
 #include "Systems/HydroponicsContainer.h"
 #include "Systems/TimeManager.h"
+#include "Systems/SimulationJournal.h"
+#include "Core/HydroGrowPlayerController.h"
+#include "Network/HydroGrowNetworkGameState.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "Net/UnrealNetwork.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "TimerManager.h"
+
+namespace
+{
+	// How far clients' extrapolation may drift from the simulation before the server re-anchors
+	constexpr float ProgressDriftTolerance = 0.002f;
+	constexpr float AgeDriftToleranceDays = 1.0f / 1440.0f;
+	constexpr float HealthDriftTolerance = 0.5f;
+
+	// Change in OverallGrowthRate that changes the replicated rates
+	constexpr float GrowthFactorTolerance = 0.01f;
+}
+
+// Network serialization for FPlantReplicatedState
+void FPlantReplicatedState::Pack(EPlantGrowthStage InStage, float InProgress, float InAgeDays, float InHealth, float InMaxHealth,
+	float InGrowthRate, float InHealthRate, int64 InReferenceTicks)
+{
+	Stage = static_cast<uint8>(InStage);
+	Progress = static_cast<uint16>(FMath::RoundToInt(FMath::Clamp(InProgress, 0.0f, 1.0f) * ProgressSteps));
+	Age = static_cast<uint32>(FMath::RoundToInt(FMath::Max(0.0f, InAgeDays) / AgeStepDays));
+	
+	MaxHealth = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InMaxHealth), 1, static_cast<int32>(MAX_uint16)));
+	Health = InMaxHealth > 0.0f ? static_cast<uint16>(FMath::RoundToInt(FMath::Clamp(InHealth / InMaxHealth, 0.0f, 1.0f) * FullHealth)) : 0;
+	
+	GrowthRate = InGrowthRate;
+	HealthRate = InHealthRate;
+	ReferenceTicks = InReferenceTicks;
+}
+
+void FPlantReplicatedState::RecordAction(int32 PlayerId)
+{
+	ActionPlayerId = PlayerId;
+	
+	// 0 means no action, so skip it on wrap-around
+	ActionSerial = ActionSerial == MAX_uint8 ? 1 : ActionSerial + 1;
+}
+
+void FPlantReplicatedState::Extrapolate(int64 GameTicks, float& OutProgress, float& OutAgeDays, float& OutHealth) const
+{
+	const float Seconds = static_cast<float>(static_cast<double>(FMath::Max<int64>(GameTicks - ReferenceTicks, 0)) / FGameDateTime::TicksPerSecond);
+	
+	// Dead plants stop simulating
+	if (GetStage() == EPlantGrowthStage::Dead)
+	{
+		OutProgress = GetProgress();
+		OutAgeDays = GetAgeInDays();
+		OutHealth = GetHealth();
+		return;
+	}
+	
+	OutProgress = FMath::Min(GetProgress() + GrowthRate * Seconds, 1.0f);
+	OutAgeDays = GetAgeInDays() + Seconds / 86400.0f;
+	OutHealth = FMath::Clamp(GetHealth() + HealthRate * Seconds / 3600.0f, 0.0f, GetMaxHealth());
+}
+
+bool FPlantReplicatedState::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	enum : uint8
+	{
+		HasHealth = 1 << 0,
+		HasMaxHealth = 1 << 1,
+		HasAction = 1 << 2,
+		HasGrowthRate = 1 << 3,
+		HasHealthRate = 1 << 4
+	};
+	
+	uint8 Mask = 0;
+	if (Ar.IsSaving())
+	{
+		Mask |= Health != FullHealth ? HasHealth : 0;
+		Mask |= MaxHealth != DefaultMaxHealth ? HasMaxHealth : 0;
+		Mask |= ActionSerial != 0 ? HasAction : 0;
+		Mask |= GrowthRate != 0.0f ? HasGrowthRate : 0;
+		Mask |= HealthRate != 0.0f ? HasHealthRate : 0;
+	}
+	Ar.SerializeBits(&Mask, 5);
+	Ar.SerializeBits(&Stage, 3);
+	Ar << Progress;
+	Ar.SerializeIntPacked(Age);
+	
+	// Game ticks are never negative
+	uint64 PackedReferenceTicks = static_cast<uint64>(FMath::Max<int64>(ReferenceTicks, 0));
+	Ar.SerializeIntPacked64(PackedReferenceTicks);
+	ReferenceTicks = static_cast<int64>(PackedReferenceTicks);
+	
+	if (Mask & HasHealth)
+	{
+		Ar << Health;
+	}
+	else if (Ar.IsLoading())
+	{
+		Health = FullHealth;
+	}
+	
+	if (Mask & HasMaxHealth)
+	{
+		Ar << MaxHealth;
+	}
+	else if (Ar.IsLoading())
+	{
+		MaxHealth = DefaultMaxHealth;
+	}
+	
+	if (Mask & HasGrowthRate)
+	{
+		Ar << GrowthRate;
+	}
+	else if (Ar.IsLoading())
+	{
+		GrowthRate = 0.0f;
+	}
+	
+	if (Mask & HasHealthRate)
+	{
+		Ar << HealthRate;
+	}
+	else if (Ar.IsLoading())
+	{
+		HealthRate = 0.0f;
+	}
+	
+	if (Mask & HasAction)
+	{
+		// Player ids are non-negative, so shift INDEX_NONE to 0 for packing
+		uint32 PackedPlayerId = static_cast<uint32>(ActionPlayerId + 1);
+		Ar.SerializeIntPacked(PackedPlayerId);
+		ActionPlayerId = static_cast<int32>(PackedPlayerId) - 1;
+		Ar << ActionSerial;
+	}
+	else if (Ar.IsLoading())
+	{
+		ActionPlayerId = INDEX_NONE;
+		ActionSerial = 0;
+	}
+	
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
 
 APlantActor::APlantActor()
 {
+	// Growth is driven by the fixed-step simulation, not the frame tick; clients tick slowly
+	// to extrapolate it between replicated updates
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickInterval = 0.25f;
 	
-	// Enable replication
+	// Enable replication; the packed state changes rarely, and stage changes and actions force an update
 	bReplicates = true;
-	bAlwaysRelevant = true;
+	SetNetUpdateFrequency(2.0f);
 
 	// Create components
 	RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
@@ -42,7 +190,21 @@ APlantActor::APlantActor()
 	NutrientEffectiveness = 1.0f;
 	LightEffectiveness = 1.0f;
 	TemperatureEffectiveness = 1.0f;
+	ReportedProblems = 0;
 	OverallGrowthRate = 1.0f;
+	
+	SignificanceTier = ESignificanceTier::Near;
+	bSignificanceManaged = false;
+	bVisualUpdatePending = false;
+	DeferredSimulationSeconds = 0.0f;
+	MaxDeferredSimulationSeconds = 0.0f;
+	VisualScaleHysteresis = 0.02f;
+	AppliedVisualScale = -1.0f;
+	AppliedGrowthStage = EPlantGrowthStage::Seed;
+	bAppliedStaticMeshMode = false;
+	AnchoredGrowthFactor = -1.0f;
+	LastSeenActionSerial = 0;
+	SimulationID = 0;
 
 	// Default to not using static meshes
 	bUseStaticMeshes = false;
@@ -62,34 +224,195 @@ void APlantActor::BeginPlay()
 	LastActionTime = FDateTime::Now();
 	LastActionPlayer = TEXT("System");
 	
+	// Only the server simulates growth
+	if (HasAuthority() && TimeManager)
+	{
+		SimulationStepHandle = TimeManager->OnSimulationStep.AddUObject(this, &APlantActor::SimulateStep);
+		PredictNextEventHandle = TimeManager->OnPredictNextEvent.AddUObject(this, &APlantActor::PredictNextEvent);
+	}
+	
+	if (HasAuthority())
+	{
+		if (USimulationJournal* Journal = USimulationJournal::Get(this))
+		{
+			SimulationID = Journal->RegisterSimulationActor(this, SimulationID);
+		}
+		
+		PackReplicatedState();
+	}
+	else
+	{
+		SetActorTickEnabled(true);
+	}
+	
+	if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
+	{
+		Significance->RegisterPlant(this);
+		bSignificanceManaged = true;
+	}
+	
 	UpdateVisualAppearanceInternal();
 }
 
+void APlantActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bSignificanceManaged)
+	{
+		if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
+		{
+			Significance->Unregister(this);
+		}
+		bSignificanceManaged = false;
+	}
+	
+	if (TimeManager && SimulationStepHandle.IsValid())
+	{
+		TimeManager->OnSimulationStep.Remove(SimulationStepHandle);
+		TimeManager->OnPredictNextEvent.Remove(PredictNextEventHandle);
+		SimulationStepHandle.Reset();
+		PredictNextEventHandle.Reset();
+	}
+	
+	if (HasAuthority())
+	{
+		if (USimulationJournal* Journal = USimulationJournal::Get(this))
+		{
+			Journal->UnregisterSimulationActor(this, SimulationID);
+		}
+	}
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+void APlantActor::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	
+	// Clients only
+	if (ExtrapolateReplicatedState())
+	{
+		UpdateVisualAppearanceInternal();
+	}
+}
+
 void APlantActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	
 	// Replicate plant state to all clients
 	DOREPLIFETIME(APlantActor, PlantSpeciesID);
-	DOREPLIFETIME(APlantActor, CurrentGrowthStage);
-	DOREPLIFETIME(APlantActor, GrowthProgress);
-	DOREPLIFETIME(APlantActor, AgeInDays);
-	DOREPLIFETIME(APlantActor, HealthPoints);
-	DOREPLIFETIME(APlantActor, MaxHealthPoints);
-	DOREPLIFETIME(APlantActor, LastActionPlayer);
-	DOREPLIFETIME(APlantActor, LastActionTime);
+	DOREPLIFETIME(APlantActor, ReplicatedState);
 }
 
-void APlantActor::Tick(float DeltaTime)
+void APlantActor::SimulateStep(const FSimulationStepContext& Step)
 {
-	Super::Tick(DeltaTime);
+	if (!IsAlive())
+	{
+		return;
+	}
+	
+	// Insignificant plants bank fine steps and integrate them in one closed-form step
+	if (Step.Tier == ESimulationTier::Fine && MaxDeferredSimulationSeconds > 0.0f)
+	{
+		DeferredSimulationSeconds += Step.DeltaGameSeconds;
+		if (DeferredSimulationSeconds >= MaxDeferredSimulationSeconds)
+		{
+			FlushDeferredSimulation();
+		}
+		return;
+	}
+	
+	if (Step.Tier == ESimulationTier::Coarse)
+	{
+		SimulateCoarseStep(DeferredSimulationSeconds + Step.DeltaGameSeconds);
+		DeferredSimulationSeconds = 0.0f;
+		return;
+	}
+	
+	FlushDeferredSimulation();
+	
+	UpdateGrowthProgress(Step.DeltaGameSeconds);
+	UpdateHealthPoints(Step.DeltaGameSeconds);
+	CalculateGrowthFactors();
+	CheckForProblems();
+	PackReplicatedState();
+}
+
+void APlantActor::SimulateCoarseStep(float DeltaTime)
+{
+	// Rates are held for the whole chunk, so take them from the conditions at its start
+	CalculateGrowthFactors();
+	
+	// Growth stops when the plant dies, which may be partway through the chunk
+	float GrowthSeconds = DeltaTime;
+	const float HealthPerHour = GetHealthChangePerHour();
+	if (HealthPerHour < 0.0f)
+	{
+		GrowthSeconds = FMath::Min(GrowthSeconds, HealthPoints / -HealthPerHour * 3600.0f);
+	}
+	
+	UpdateGrowthProgress(GrowthSeconds);
+	UpdateHealthPoints(DeltaTime);
+	CheckForProblems();
+	PackReplicatedState();
+}
+
+void APlantActor::PredictNextEvent(double& InOutSeconds) const
+{
+	if (!IsAlive())
+	{
+		return;
+	}
+	
+	// Deferred time is simulated with the next chunk, so events come that much sooner
+	const double Deferred = DeferredSimulationSeconds;
 	
+	const float GrowthRate = GetGrowthRatePerSecond();
+	if (GrowthRate > 0.0f && GrowthProgress < HarvestThreshold)
+	{
+		InOutSeconds = FMath::Min(InOutSeconds, FMath::Max(0.0, (GetNextStageThreshold() - GrowthProgress) / GrowthRate - Deferred));
+	}
+	
+	const float HealthPerHour = GetHealthChangePerHour();
+	if (HealthPerHour < 0.0f)
+	{
+		InOutSeconds = FMath::Min(InOutSeconds, FMath::Max(0.0, HealthPoints / -HealthPerHour * 3600.0 - Deferred));
+	}
+}
+
+void APlantActor::FlushDeferredSimulation()
+{
+	if (DeferredSimulationSeconds <= 0.0f)
+	{
+		return;
+	}
+	
+	const float Seconds = DeferredSimulationSeconds;
+	DeferredSimulationSeconds = 0.0f;
 	if (IsAlive())
 	{
-		UpdateGrowthProgress(DeltaTime);
-		UpdateHealthPoints(DeltaTime);
-		CalculateGrowthFactors();
-		CheckForProblems();
+		SimulateCoarseStep(Seconds);
+	}
+}
+
+void APlantActor::SetSignificance(ESignificanceTier Tier, float MaxDeferredGameSeconds)
+{
+	SignificanceTier = Tier;
+	MaxDeferredSimulationSeconds = MaxDeferredGameSeconds;
+	
+	// Promoted, or the bound tightened: catch up before anyone looks
+	if (DeferredSimulationSeconds > 0.0f && DeferredSimulationSeconds >= MaxDeferredSimulationSeconds)
+	{
+		FlushDeferredSimulation();
+	}
+}
+
+void APlantActor::ApplyPendingVisualUpdate()
+{
+	if (bVisualUpdatePending)
+	{
+		bVisualUpdatePending = false;
+		ApplyVisualAppearance();
 	}
 }
 
@@ -111,6 +434,7 @@ void APlantActor::InitializePlant(FName lantSpeciesID, AHydroponicsContainer* Co
 		UE_LOG(LogTemp, Error, TEXT("Failed to find plant data for ID: %s"), *PlantSpeciesID.ToString());
 	}
 	
+	PackReplicatedState();
 	UpdateVisualAppearanceInternal();
 }
 
@@ -126,13 +450,25 @@ bool APlantActor::CanHarvestPlant() const
 
 int32 APlantActor::Harvest()
 {
+	return HarvestFor(nullptr);
+}
+
+int32 APlantActor::HarvestFor(const APlayerState* Instigator)
+{
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		Journal->Record(FJournalEntry(EJournalCommand::HarvestPlant, SimulationID, FString()));
+	}
+	
+	FlushDeferredSimulation();
+	
 	if (!CanHarvestPlant())
 	{
 		return 0;
 	}
 	
-	const FPlantSpeciesData* PlantData = (GameInstance ? GameInstance->GetPlantData(PlantSpeciesID) : nullptr);
-	if (!PlantData)
+	const FPlantSpeciesStats* Stats = GetSpeciesStats();
+	if (!Stats)
 	{
 		return 0;
 	}
@@ -141,49 +477,80 @@ int32 APlantActor::Harvest()
 	float YieldMultiplier = (HealthPoints / MaxHealthPoints) * OverallGrowthRate;
 	YieldMultiplier = FMath::Clamp(YieldMultiplier, 0.1f, 1.5f); // Allow bonus yield for perfect conditions
 	
-	int32 FinalYield = FMath::RoundToInt(PlantData->BaseYield * YieldMultiplier);
+	int32 FinalYield = FMath::RoundToInt(Stats->BaseYield * YieldMultiplier);
 	
 	OnPlantHarvested.Broadcast(FinalYield);
 	
 	UE_LOG(LogTemp, Warning, TEXT("Harvested %s: %d yield (multiplier: %.2f)"), 
-		*PlantData->DisplayName.ToString(), FinalYield, YieldMultiplier);
+		*GameInstance->GetPlantDisplayName(GetSpecies()).ToString(), FinalYield, YieldMultiplier);
+	
+	// Destroying the plant closes its channel, so this frame's batch goes out now, ahead of the
+	// close, instead of on the next tick
+	QueueCosmeticEvent(EPlantCosmeticEvent::Harvested, FinalYield, Instigator ? Instigator->GetPlayerId() : INDEX_NONE);
+	FlushCosmeticEvents();
 	
-	// Reset plant or destroy it
 	Destroy();
 	
 	return FinalYield;
 }
 
-int32 APlantActor::HarvestPlant(const FString& PlayerName)
+int32 APlantActor::HarvestPlant(AHydroGrowPlayerController* InstigatingController)
 {
 	if (HasAuthority())
 	{
-		return Harvest();
+		return HarvestFor(InstigatingController ? InstigatingController->PlayerState : nullptr);
 	}
-	else
+	
+	// Clients cannot call server RPCs on plants they do not own, so the request goes through their controller
+	AHydroGrowPlayerController* PlayerController = InstigatingController;
+	if (!PlayerController)
+	{
+		UGameInstance* OwningGameInstance = GetGameInstance();
+		if (OwningGameInstance && OwningGameInstance->GetNumLocalPlayers() == 1)
+		{
+			PlayerController = Cast<AHydroGrowPlayerController>(OwningGameInstance->GetFirstLocalPlayerController(GetWorld()));
+		}
+	}
+	
+	if (PlayerController)
 	{
-		// On client, send server request
-		Server_HarvestPlant(PlayerName);
-		return 0; // Return 0 for now, server will handle the actual harvest
+		PlayerController->Server_HarvestPlant(this);
 	}
+	return 0; // The server handles the actual harvest
 }
 
 void APlantActor::WaterPlant(float WaterAmount)
 {
+	FlushDeferredSimulation();
+	
 	// Watering restores some health and helps with nutrient uptake
 	float HealthRestore = WaterAmount * 5.0f;
 	HealthPoints = FMath::Min(HealthPoints + HealthRestore, MaxHealthPoints);
+	PackReplicatedState();
 	
-	UE_LOG(LogTemp, Log, TEXT("Watered plant, health: %.1f"), HealthPoints);
+	UE_LOG(LogTemp, Verbose, TEXT("Watered plant, health: %.1f"), HealthPoints);
 }
 
 void APlantActor::ApplyNutrients(const FNutrientLevels& Nutrients)
 {
+	FlushDeferredSimulation();
+	
 	CurrentNutrients = Nutrients;
 	
 	// Nutrients boost growth and health
 	float NutrientBoost = (Nutrients.Nitrogen + Nutrients.Phosphorus + Nutrients.Potassium) / 3.0f;
 	HealthPoints = FMath::Min(HealthPoints + NutrientBoost * 2.0f, MaxHealthPoints);
+	PackReplicatedState();
+}
+
+uint32 APlantActor::GetSimulationStateHash() const
+{
+	const float Values[] = { GrowthProgress, AgeInDays, HealthPoints, OverallGrowthRate };
+	const int32 Stage = static_cast<int32>(CurrentGrowthStage);
+	
+	uint32 Hash = FCrc::MemCrc32(&SimulationID, sizeof(SimulationID));
+	Hash = FCrc::MemCrc32(Values, sizeof(Values), Hash);
+	return FCrc::MemCrc32(&Stage, sizeof(Stage), Hash);
 }
 
 float APlantActor::GetGrowthPercentage() const
@@ -196,6 +563,20 @@ float APlantActor::GetHealthPercentage() const
 	return (HealthPoints / MaxHealthPoints) * 100.0f;
 }
 
+const FPlantSpeciesHandle& APlantActor::GetSpecies() const
+{
+	if (GameInstance && (Species.SpeciesID != PlantSpeciesID || !GameInstance->IsCurrent(Species)))
+	{
+		Species = GameInstance->FindPlantSpecies(PlantSpeciesID);
+	}
+	return Species;
+}
+
+const FPlantSpeciesStats* APlantActor::GetSpeciesStats() const
+{
+	return GameInstance ? GameInstance->FindPlantStats(GetSpecies()) : nullptr;
+}
+
 FPlantSpeciesData APlantActor::GetPlantData() const
 {
 	if (GameInstance)
@@ -215,36 +596,68 @@ void APlantActor::SetEnvironmentalConditions(const FEnvironmentalConditions& Con
 	CurrentEnvironment = Conditions;
 }
 
+void APlantActor::SetNutrientLevels(const FNutrientLevels& Nutrients)
+{
+	CurrentNutrients = Nutrients;
+}
+
 void APlantActor::UpdateGrowthProgress(float DeltaTime)
 {
-	const FPlantSpeciesData* PlantData = (GameInstance ? GameInstance->GetPlantData(PlantSpeciesID) : nullptr);
-	if (!PlantData)
-	{
-		return;
-	}
+	// DeltaTime is in game seconds
+	AgeInDays += DeltaTime / 86400.0f; // Convert seconds to days
+	
+	// Growth is linear at the current rate, so walk stage thresholds in order and the result is
+	// the same however long the step is
+	const float GrowthRate = GetGrowthRatePerSecond();
+	float RemainingSeconds = DeltaTime;
 	
-	// Convert real time to game time
-	float GameDeltaTime = DeltaTime;
-	if (TimeManager)
+	while (GrowthRate > 0.0f && RemainingSeconds > 0.0f && GrowthProgress < 1.0f)
 	{
-		GameDeltaTime *= TimeManager->GetCurrentTimeScale();
+		const float NextThreshold = GetNextStageThreshold();
+		const float SecondsToThreshold = (NextThreshold - GrowthProgress) / GrowthRate;
+		if (SecondsToThreshold > RemainingSeconds)
+		{
+			GrowthProgress += GrowthRate * RemainingSeconds;
+			break;
+		}
+		
+		GrowthProgress = NextThreshold;
+		RemainingSeconds -= SecondsToThreshold;
+		UpdateGrowthStage();
 	}
 	
-	// Update age
-	AgeInDays += GameDeltaTime / 86400.0f; // Convert seconds to days
-	
-	// Calculate growth rate based on environmental factors
-	float BaseGrowthRate = 1.0f / (PlantData->GrowthTimeInDays * 86400.0f); // Growth per second
-	float ModifiedGrowthRate = BaseGrowthRate * OverallGrowthRate;
-	
-	// Apply growth
-	GrowthProgress += ModifiedGrowthRate * GameDeltaTime;
 	GrowthProgress = FMath::Clamp(GrowthProgress, 0.0f, 1.0f);
 	
 	// Check for stage transitions
 	UpdateGrowthStage();
 }
 
+float APlantActor::GetGrowthRatePerSecond() const
+{
+	const FPlantSpeciesStats* Stats = GetSpeciesStats();
+	if (!Stats || Stats->GrowthTimeInDays <= 0.0f)
+	{
+		return 0.0f;
+	}
+	
+	// Calculate growth rate based on environmental factors
+	float BaseGrowthRate = 1.0f / (Stats->GrowthTimeInDays * 86400.0f); // Growth per second
+	return BaseGrowthRate * OverallGrowthRate;
+}
+
+float APlantActor::GetNextStageThreshold() const
+{
+	const float Thresholds[] = { SeedlingThreshold, VegetativeThreshold, FloweringThreshold, HarvestThreshold };
+	for (float Threshold : Thresholds)
+	{
+		if (GrowthProgress < Threshold)
+		{
+			return Threshold;
+		}
+	}
+	return 1.0f;
+}
+
 void APlantActor::UpdateGrowthStage()
 {
 	EPlantGrowthStage NewStage = CurrentGrowthStage;
@@ -272,51 +685,69 @@ void APlantActor::UpdateGrowthStage()
 		OnGrowthStageChanged.Broadcast(CurrentGrowthStage);
 		UpdateVisualAppearanceInternal();
 		
+		if (TimeManager)
+		{
+			TimeManager->NotifySimulationEvent();
+		}
+		
 		UE_LOG(LogTemp, Warning, TEXT("Plant growth stage changed to: %d"), (int32)CurrentGrowthStage);
 	}
 }
 
 void APlantActor::UpdateHealthPoints(float DeltaTime)
 {
-	// Health degrades if environmental conditions are poor
+	// Linear with clamping, so exact for any step length
+	float HealthChange = GetHealthChangePerHour() * DeltaTime / 3600.0f;
+	
+	HealthPoints = FMath::Clamp(HealthPoints + HealthChange, 0.0f, MaxHealthPoints);
+	
+	// Check if plant dies
+	if (HealthPoints <= 0.0f)
+	{
+		CurrentGrowthStage = EPlantGrowthStage::Dead;
+		UpdateVisualAppearanceInternal();
+		UE_LOG(LogTemp, Warning, TEXT("Plant has died"));
+		
+		if (TimeManager)
+		{
+			TimeManager->NotifySimulationEvent();
+		}
+	}
+}
+
+float APlantActor::GetHealthChangePerHour() const
+{
+	// Health degrades if environmental conditions are poor (rates are per game hour)
 	float HealthChange = 0.0f;
 	
 	// Poor growth conditions cause health loss
 	if (OverallGrowthRate < 0.5f)
 	{
-		HealthChange -= (1.0f - OverallGrowthRate) * 10.0f * DeltaTime;
+		HealthChange -= (1.0f - OverallGrowthRate) * 10.0f;
 	}
 	
 	// Good conditions slowly restore health
 	if (OverallGrowthRate > 0.8f)
 	{
-		HealthChange += (OverallGrowthRate - 0.8f) * 5.0f * DeltaTime;
+		HealthChange += (OverallGrowthRate - 0.8f) * 5.0f;
 	}
 	
-	HealthPoints = FMath::Clamp(HealthPoints + HealthChange, 0.0f, MaxHealthPoints);
-	
-	// Check if plant dies
-	if (HealthPoints <= 0.0f)
-	{
-		CurrentGrowthStage = EPlantGrowthStage::Dead;
-		UpdateVisualAppearanceInternal();
-		UE_LOG(LogTemp, Warning, TEXT("Plant has died"));
-	}
+	return HealthChange;
 }
 
 void APlantActor::CalculateGrowthFactors()
 {
-	const FPlantSpeciesData* PlantData = (GameInstance ? GameInstance->GetPlantData(PlantSpeciesID) : nullptr);
-	if (!PlantData)
+	const FPlantSpeciesStats* Stats = GetSpeciesStats();
+	if (!Stats)
 	{
 		return;
 	}
 	
 	// Calculate individual effectiveness factors
-	PHEffectiveness = CalculatePHEffect(CurrentEnvironment.PHLevel, PlantData->OptimalPHRange);
-	NutrientEffectiveness = CalculateNutrientEffect(CurrentEnvironment.ECLevel, PlantData->OptimalECRange);
-	LightEffectiveness = CalculateLightEffect(CurrentEnvironment.LightIntensity, PlantData->LightHoursRequired);
-	TemperatureEffectiveness = CalculateTemperatureEffect(CurrentEnvironment.Temperature, PlantData->OptimalTemperatureRange);
+	PHEffectiveness = CalculatePHEffect(CurrentEnvironment.PHLevel, Stats->OptimalPHRange);
+	NutrientEffectiveness = CalculateNutrientEffect(CurrentEnvironment.ECLevel, Stats->OptimalECRange);
+	LightEffectiveness = CalculateLightEffect(CurrentEnvironment.LightIntensity, Stats->LightHoursRequired);
+	TemperatureEffectiveness = CalculateTemperatureEffect(CurrentEnvironment.Temperature, Stats->OptimalTemperatureRange);
 	
 	// Overall growth rate is the product of all factors
 	OverallGrowthRate = PHEffectiveness * NutrientEffectiveness * LightEffectiveness * TemperatureEffectiveness;
@@ -376,6 +807,7 @@ void APlantActor::ApplyMeshConfiguration(const FPlantMeshConfiguration& Config)
 	}
 
 	// Update visual appearance with new meshes
+	AppliedVisualScale = -1.0f;
 	UpdateVisualAppearance();
 
 	UE_LOG(LogTemp, Log, TEXT("Applied mesh configuration for plant: %s"), *Config.PlantDisplayName);
@@ -383,43 +815,77 @@ void APlantActor::ApplyMeshConfiguration(const FPlantMeshConfiguration& Config)
 
 void APlantActor::UpdateVisualAppearanceInternal()
 {
-	// Calculate visual effects
-	FVector Scale = FVector::OneVector;
+	// Queue for USignificanceSubsystem's per-frame batch, so a step that changes stage, health
+	// and progress (plus the matching rep-notifies on clients) costs one update
+	if (bSignificanceManaged)
+	{
+		bVisualUpdatePending = true;
+		return;
+	}
 	
+	bVisualUpdatePending = false;
+	ApplyVisualAppearance();
+}
+
+void APlantActor::ApplyVisualAppearance()
+{
+	// Calculate visual effects
 	// Scale based on growth progress
 	float GrowthScale = FMath::Lerp(0.1f, 1.0f, GrowthProgress);
-	Scale *= GrowthScale;
 	
 	// Reduce scale if unhealthy
 	float HealthScale = FMath::Lerp(0.7f, 1.0f, HealthPoints / MaxHealthPoints);
-	Scale *= HealthScale;
+	const float Scale = GrowthScale * HealthScale;
 	
-	if (bUseStaticMeshes && StaticPlantMesh)
+	const bool bStaticMode = bUseStaticMeshes && StaticPlantMesh;
+	UMeshComponent* ActiveMesh = bStaticMode ? static_cast<UMeshComponent*>(StaticPlantMesh) : static_cast<UMeshComponent*>(PlantMesh);
+	if (!ActiveMesh)
+	{
+		return;
+	}
+	
+	// Visibility and mesh only change with the mode or stage; scale drifts every step, so it is
+	// only pushed to the render thread once the change would be noticed
+	const bool bFirstApply = AppliedVisualScale < 0.0f;
+	const bool bModeChanged = bFirstApply || bStaticMode != bAppliedStaticMeshMode;
+	const bool bStageChanged = bFirstApply || CurrentGrowthStage != AppliedGrowthStage;
+	
+	if (bModeChanged)
+	{
+		if (bStaticMode)
+		{
+			// Use Ultimate Farming Kit static meshes
+			PlantMesh->SetVisibility(false);
+			StaticPlantMesh->SetVisibility(true);
+		}
+		else
+		{
+			// Use procedural mesh system
+			StaticPlantMesh->SetVisibility(false);
+			PlantMesh->SetVisibility(true);
+		}
+		bAppliedStaticMeshMode = bStaticMode;
+	}
+	
+	if (bStaticMode && (bModeChanged || bStageChanged))
 	{
-		// Use Ultimate Farming Kit static meshes
-		PlantMesh->SetVisibility(false);
-		StaticPlantMesh->SetVisibility(true);
-		
 		// Select appropriate mesh based on growth stage and health
 		UStaticMesh* SelectedMesh = GetMeshForCurrentState();
 		if (SelectedMesh && StaticPlantMesh->GetStaticMesh() != SelectedMesh)
 		{
 			StaticPlantMesh->SetStaticMesh(SelectedMesh);
 		}
-		
-		StaticPlantMesh->SetWorldScale3D(Scale);
 	}
-	else if (PlantMesh)
+	AppliedGrowthStage = CurrentGrowthStage;
+	
+	if (bModeChanged || bStageChanged || FMath::Abs(Scale - AppliedVisualScale) > VisualScaleHysteresis * AppliedVisualScale)
 	{
-		// Use procedural mesh system
-		StaticPlantMesh->SetVisibility(false);
-		PlantMesh->SetVisibility(true);
-		
-		PlantMesh->SetWorldScale3D(Scale);
-		
-		// Change color based on health
-		// This would be implemented with material parameter changes
+		ActiveMesh->SetWorldScale3D(FVector(Scale));
+		AppliedVisualScale = Scale;
 	}
+	
+	// Change color based on health
+	// This would be implemented with material parameter changes
 }
 
 UStaticMesh* APlantActor::GetMeshForCurrentState() const
@@ -477,29 +943,23 @@ UStaticMesh* APlantActor::GetMeshForCurrentState() const
 
 void APlantActor::CheckForProblems()
 {
-	// Log warnings for poor conditions
-	if (PHEffectiveness < 0.7f)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Plant %s: Poor pH conditions (%.2f effectiveness)"), 
-			*PlantSpeciesID.ToString(), PHEffectiveness);
-	}
+	// Warn once when a condition turns poor rather than every step it stays poor
+	const float Effectiveness[] = { PHEffectiveness, NutrientEffectiveness, LightEffectiveness, TemperatureEffectiveness };
+	static const TCHAR* ProblemNames[] = { TEXT("pH"), TEXT("nutrient"), TEXT("light"), TEXT("temperature") };
 	
-	if (NutrientEffectiveness < 0.7f)
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Effectiveness); i++)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Plant %s: Poor nutrient conditions (%.2f effectiveness)"), 
-			*PlantSpeciesID.ToString(), NutrientEffectiveness);
-	}
-	
-	if (LightEffectiveness < 0.7f)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Plant %s: Poor light conditions (%.2f effectiveness)"), 
-			*PlantSpeciesID.ToString(), LightEffectiveness);
-	}
-	
-	if (TemperatureEffectiveness < 0.7f)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Plant %s: Poor temperature conditions (%.2f effectiveness)"), 
-			*PlantSpeciesID.ToString(), TemperatureEffectiveness);
+		const uint8 ProblemBit = 1 << i;
+		if (Effectiveness[i] >= 0.7f)
+		{
+			ReportedProblems &= ~ProblemBit;
+		}
+		else if (!(ReportedProblems & ProblemBit))
+		{
+			ReportedProblems |= ProblemBit;
+			UE_LOG(LogTemp, Warning, TEXT("Plant %s: Poor %s conditions (%.2f effectiveness)"), 
+				*PlantSpeciesID.ToString(), ProblemNames[i], Effectiveness[i]);
+		}
 	}
 }
 
@@ -554,77 +1014,173 @@ float APlantActor::CalculateTemperatureEffect(float CurrentTemp, const FVector2D
 	return FMath::Max(0.1f, 1.0f - Distance * 0.1f);
 }
 
-// Network function implementations
-void APlantActor::Server_HarvestPlant_Implementation(const FString& PlayerName)
+// Server player actions
+void APlantActor::WaterPlantFor(float WaterAmount, const APlayerState* Instigator)
 {
-	if (CanHarvestPlant())
-	{
-		int32 Yield = Harvest();
-		LastActionPlayer = PlayerName;
-		LastActionTime = FDateTime::Now();
-		
-		// Broadcast to all clients
-		Multicast_PlantHarvested(Yield, PlayerName);
-	}
+	WaterPlant(WaterAmount);
+	RecordAction(Instigator);
 }
 
-bool APlantActor::Server_HarvestPlant_Validate(const FString& PlayerName)
+void APlantActor::ApplyNutrientsFor(const FNutrientLevels& Nutrients, const APlayerState* Instigator)
 {
-	return true; // Add any validation logic if needed
+	ApplyNutrients(Nutrients);
+	RecordAction(Instigator);
 }
 
-void APlantActor::Server_WaterPlant_Implementation(float WaterAmount, const FString& PlayerName)
+void APlantActor::QueueCosmeticEvent(EPlantCosmeticEvent Type, int32 Value, int32 PlayerId)
 {
-	WaterPlant(WaterAmount);
-	LastActionPlayer = PlayerName;
-	LastActionTime = FDateTime::Now();
+	if (!HasAuthority())
+	{
+		return;
+	}
+	
+	if (PendingCosmeticEvents.Num() == 0)
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &APlantActor::FlushCosmeticEvents);
+	}
+	PendingCosmeticEvents.Emplace(Type, Value, PlayerId);
 }
 
-bool APlantActor::Server_WaterPlant_Validate(float WaterAmount, const FString& PlayerName)
+void APlantActor::FlushCosmeticEvents()
 {
-	return WaterAmount > 0.0f; // Ensure positive water amount
+	if (PendingCosmeticEvents.Num() > 0)
+	{
+		Multicast_PlantCosmeticEvents(PendingCosmeticEvents);
+		PendingCosmeticEvents.Reset();
+	}
 }
 
-void APlantActor::Server_ApplyNutrients_Implementation(const FNutrientLevels& Nutrients, const FString& PlayerName)
-{
-	ApplyNutrients(Nutrients);
-	LastActionPlayer = PlayerName;
-	LastActionTime = FDateTime::Now();
-}
-bool APlantActor::Server_ApplyNutrients_Validate(const FNutrientLevels& Nutrients, const FString& PlayerName)
+void APlantActor::Multicast_PlantCosmeticEvents_Implementation(const TArray<FPlantCosmeticEvent>& Events)
 {
-	return Nutrients.IsValid(); // Ensure nutrient levels are valid
+	for (const FPlantCosmeticEvent& Event : Events)
+	{
+		switch (Event.Type)
+		{
+		case EPlantCosmeticEvent::Harvested:
+			// Harvest already broadcast this on the server
+			if (!HasAuthority())
+			{
+				OnPlantHarvested.Broadcast(Event.Value);
+			}
+			UE_LOG(LogTemp, Warning, TEXT("Plant harvested by %s: %d yield"), *ResolvePlayerName(Event.PlayerId), Event.Value);
+			break;
+		}
+	}
 }
 
-void APlantActor::Multicast_PlantGrowthStageChanged_Implementation(EPlantGrowthStage NewStage)
+void APlantActor::PackReplicatedState()
 {
-	UpdateVisualAppearanceInternal();
-	OnGrowthStageChanged.Broadcast(NewStage);
+	const int64 Now = GetReplicationClockTicks();
+	const bool bStageChanged = ReplicatedState.GetStage() != CurrentGrowthStage;
+	const bool bGrowthFactorChanged = FMath::Abs(OverallGrowthRate - AnchoredGrowthFactor) > GrowthFactorTolerance;
+	
+	// Compare against what clients show now; clamps, actions and deferred catch-up all surface here
+	float ClientProgress, ClientAgeDays, ClientHealth;
+	ReplicatedState.Extrapolate(Now, ClientProgress, ClientAgeDays, ClientHealth);
+	const bool bDrifted = FMath::Abs(ClientProgress - GrowthProgress) > ProgressDriftTolerance
+		|| FMath::Abs(ClientAgeDays - AgeInDays) > AgeDriftToleranceDays
+		|| FMath::Abs(ClientHealth - HealthPoints) > HealthDriftTolerance
+		|| ReplicatedState.GetMaxHealth() != FMath::RoundToFloat(MaxHealthPoints);
+	
+	if (!bStageChanged && !bGrowthFactorChanged && !bDrifted)
+	{
+		return;
+	}
+	
+	const float GrowthRate = IsAlive() ? GetGrowthRatePerSecond() : 0.0f;
+	const float HealthRate = IsAlive() ? GetHealthChangePerHour() : 0.0f;
+	ReplicatedState.Pack(CurrentGrowthStage, GrowthProgress, AgeInDays, HealthPoints, MaxHealthPoints, GrowthRate, HealthRate, Now);
+	AnchoredGrowthFactor = OverallGrowthRate;
+	
+	// The container's digest covers the state clients receive
+	if (ParentContainer)
+	{
+		ParentContainer->MarkStateDigestDirty();
+	}
+	
+	if (bStageChanged)
+	{
+		ForceNetUpdate();
+	}
 }
 
-void APlantActor::Multicast_PlantHarvested_Implementation(int32 Yield, const FString& PlayerName)
+int64 APlantActor::GetReplicationClockTicks() const
 {
-	OnPlantHarvested.Broadcast(Yield);
-	UE_LOG(LogTemp, Warning, TEXT("Plant harvested by %s: %d yield"), *PlayerName, Yield);
+	if (!HasAuthority())
+	{
+		if (const AHydroGrowNetworkGameState* GameState = GetWorld()->GetGameState<AHydroGrowNetworkGameState>())
+		{
+			return GameState->GetSharedGameTicks();
+		}
+		
+		// No shared clock: the local time manager is not in step with the server, so show the
+		// replicated values as they are instead of extrapolating
+		return ReplicatedState.ReferenceTicks;
+	}
+	
+	// Deferred game time has not been simulated yet
+	const int64 GameTicks = TimeManager ? TimeManager->GetGameTicks() : 0;
+	return GameTicks - static_cast<int64>(DeferredSimulationSeconds * FGameDateTime::TicksPerSecond);
 }
 
-void APlantActor::Multicast_PlantHealthChanged_Implementation(float NewHealth)
+void APlantActor::RecordAction(const APlayerState* Instigator)
 {
-	UpdateVisualAppearanceInternal();
+	LastActionPlayer = Instigator ? Instigator->GetPlayerName() : FString(TEXT("Unknown"));
+	LastActionTime = FDateTime::Now();
+	
+	// Clients resolve the name back from the player state id
+	ReplicatedState.RecordAction(Instigator ? Instigator->GetPlayerId() : INDEX_NONE);
+	ForceNetUpdate();
 }
 
-// Replication callbacks
-void APlantActor::OnRep_GrowthStage()
+FString APlantActor::ResolvePlayerName(int32 PlayerId) const
 {
-	Multicast_PlantGrowthStageChanged(CurrentGrowthStage);
+	if (PlayerId != INDEX_NONE)
+	{
+		if (const AGameStateBase* GameState = GetWorld()->GetGameState())
+		{
+			for (const APlayerState* PlayerState : GameState->PlayerArray)
+			{
+				if (PlayerState && PlayerState->GetPlayerId() == PlayerId)
+				{
+					return PlayerState->GetPlayerName();
+				}
+			}
+		}
+	}
+	return TEXT("Unknown");
 }
 
-void APlantActor::OnRep_HealthPoints()
+bool APlantActor::ExtrapolateReplicatedState()
 {
-	Multicast_PlantHealthChanged(HealthPoints);
+	const float PreviousProgress = GrowthProgress;
+	const float PreviousAge = AgeInDays;
+	const float PreviousHealth = HealthPoints;
+	
+	ReplicatedState.Extrapolate(GetReplicationClockTicks(), GrowthProgress, AgeInDays, HealthPoints);
+	
+	return GrowthProgress != PreviousProgress || AgeInDays != PreviousAge || HealthPoints != PreviousHealth;
 }
 
-void APlantActor::OnRep_GrowthProgress()
+// Replication callbacks
+void APlantActor::OnRep_ReplicatedState()
 {
+	const EPlantGrowthStage PreviousStage = CurrentGrowthStage;
+	CurrentGrowthStage = ReplicatedState.GetStage();
+	MaxHealthPoints = ReplicatedState.GetMaxHealth();
+	
+	if (ReplicatedState.ActionSerial != LastSeenActionSerial)
+	{
+		LastSeenActionSerial = ReplicatedState.ActionSerial;
+		LastActionTime = FDateTime::Now();
+		LastActionPlayer = ResolvePlayerName(ReplicatedState.ActionPlayerId);
+	}
+	
+	ExtrapolateReplicatedState();
 	UpdateVisualAppearanceInternal();
+	
+	if (CurrentGrowthStage != PreviousStage)
+	{
+		OnGrowthStageChanged.Broadcast(CurrentGrowthStage);
+	}
 }
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "Player/HydroGrowCharacter.h"
 #include "Components/InteractionComponent.h"
+#include "Player/InteractionQuerySubsystem.h"
 #include "Plants/PlantActor.h"
 #include "Systems/HydroponicsContainer.h"
 #include "Core/HydroGrowGameInstance.h"
+#include "Core/HydroGrowSaveGame.h"
 #include "Network/HydroGrowNetworkGameMode.h"
+#include "Core/HydroGrowPlayerController.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
+#include "Engine/LocalPlayer.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Camera/CameraComponent.h"
@@ -118,12 +122,6 @@ void AHydroGrowCharacter::BeginPlay()
 void AHydroGrowCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
-
-	// Update interaction system
-	if (IsLocallyControlled())
-	{
-		FindInteractables();
-	}
 }
 
 void AHydroGrowCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -166,7 +164,7 @@ void AHydroGrowCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	DOREPLIFETIME_CONDITION(AHydroGrowCharacter, PlayerLevel, COND_None);
 	DOREPLIFETIME_CONDITION(AHydroGrowCharacter, Experience, COND_OwnerOnly);
 	DOREPLIFETIME_CONDITION(AHydroGrowCharacter, Currency, COND_OwnerOnly);
-	DOREPLIFETIME_CONDITION(AHydroGrowCharacter, InventoryItems, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(AHydroGrowCharacter, Inventory, COND_OwnerOnly);
 }
 
 void AHydroGrowCharacter::Move(const FInputActionValue& Value)
@@ -314,47 +312,12 @@ bool AHydroGrowCharacter::SpendCurrency(int32 Amount)
 
 void AHydroGrowCharacter::FindInteractables()
 {
-	if (!InteractionComponent)
+	// Ask for a query this frame instead of waiting for the next scheduled one
+	if (const APlayerController* PlayerController = GetController<APlayerController>())
 	{
-		return;
-	}
-
-	// Get camera location and forward vector for line trace
-	FVector CameraLocation = ThirdPersonCamera->GetComponentLocation();
-	FVector CameraForward = ThirdPersonCamera->GetForwardVector();
-	FVector TraceEnd = CameraLocation + (CameraForward * InteractionRange);
-
-	// Line trace for interactables
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
-	AActor* NewInteractable = nullptr;
-
-	if (GetWorld()->LineTraceSingleByChannel(HitResult, CameraLocation, TraceEnd, ECC_Visibility, QueryParams))
-	{
-		if (AActor* HitActor = HitResult.GetActor())
-		{
-			if (CanInteractWith(HitActor))
-			{
-				NewInteractable = HitActor;
-			}
-		}
-	}
-
-	// Update current interactable
-	if (NewInteractable != CurrentInteractable)
-	{
-		if (CurrentInteractable)
-		{
-			OnInteractionLost.Broadcast();
-		}
-
-		CurrentInteractable = NewInteractable;
-
-		if (CurrentInteractable)
+		if (UInteractionQuerySubsystem* InteractionQuery = ULocalPlayer::GetSubsystem<UInteractionQuerySubsystem>(PlayerController->GetLocalPlayer()))
 		{
-			OnInteractionFound.Broadcast(CurrentInteractable);
+			InteractionQuery->RequestQuery();
 		}
 	}
 }
@@ -366,19 +329,14 @@ bool AHydroGrowCharacter::CanInteractWith(AActor* Actor) const
 		return false;
 	}
 
-	// Check if actor implements IInteractable interface
-	if (Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	// Interface actors decide for themselves; containers and plants always accept
+	const FInteractableClassInfo ClassInfo = FInteractableClassInfo::Get(Actor);
+	if (ClassInfo.UsesInterface())
 	{
 		return IInteractable::Execute_CanInteract(Actor, const_cast<AHydroGrowCharacter*>(this));
 	}
 
-	// Check for specific actor types
-	if (Actor->IsA<AHydroponicsContainer>() || Actor->IsA<APlantActor>())
-	{
-		return true;
-	}
-
-	return false;
+	return ClassInfo.IsInteractable();
 }
 
 void AHydroGrowCharacter::InteractWithActor(AActor* Actor)
@@ -388,21 +346,20 @@ void AHydroGrowCharacter::InteractWithActor(AActor* Actor)
 		return;
 	}
 
-	// Handle interface-based interaction
-	if (Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	switch (FInteractableClassInfo::Get(Actor).Kind)
 	{
+	case EInteractableKind::Interface:
+		// Handle interface-based interaction
 		IInteractable::Execute_OnInteract(Actor, this);
 		return;
-	}
-
-	// Handle specific actor types
-	if (AHydroponicsContainer* Container = Cast<AHydroponicsContainer>(Actor))
-	{
-		InteractWithContainer(Container);
-	}
-	else if (APlantActor* Plant = Cast<APlantActor>(Actor))
-	{
-		InteractWithPlant(Plant);
+	case EInteractableKind::Container:
+		InteractWithContainer(static_cast<AHydroponicsContainer*>(Actor));
+		break;
+	case EInteractableKind::Plant:
+		InteractWithPlant(static_cast<APlantActor*>(Actor));
+		break;
+	default:
+		break;
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("Player %s interacted with %s"), *PlayerName, *Actor->GetName());
@@ -421,7 +378,7 @@ void AHydroGrowCharacter::InteractWithContainer(AHydroponicsContainer* Container
 	{
 		if (APlayerState* PS = PC->GetPlayerState<APlayerState>())
 		{
-			PlayerID = FString::FromInt(PS->GetPlayerId()) + "_" + PS->GetPlayerName();
+			PlayerID = AHydroGrowNetworkGameMode::MakePlayerID(PS);
 		}
 	}
 
@@ -449,7 +406,7 @@ void AHydroGrowCharacter::InteractWithPlant(APlantActor* Plant)
 	if (Plant->CanHarvestPlant())
 	{
 		// Harvest the plant
-		Plant->HarvestPlant(PlayerName);
+		Plant->HarvestPlant(GetController<AHydroGrowPlayerController>());
 		AddExperience(10.0f); // Gain experience for harvesting
 	}
 	
@@ -463,42 +420,58 @@ void AHydroGrowCharacter::InteractWithPlant(APlantActor* Plant)
 
 bool AHydroGrowCharacter::HasItem(FName ItemID) const
 {
-	return InventoryItems.Contains(ItemID);
+	return Inventory.Contains(ItemID);
 }
 
-bool AHydroGrowCharacter::AddItem(FName ItemID)
+bool AHydroGrowCharacter::AddItem(FName ItemID, int32 Quantity)
 {
 	if (HasAuthority())
 	{
-		if (InventoryItems.Num() < MaxInventorySlots)
+		// New stacks need a free slot, existing stacks can always grow
+		if (Inventory.Contains(ItemID) || Inventory.Num() < MaxInventorySlots)
 		{
-			InventoryItems.Add(ItemID);
-			return true;
+			return Inventory.AddQuantity(ItemID, Quantity) > 0;
 		}
 	}
 	return false;
 }
 
-bool AHydroGrowCharacter::RemoveItem(FName ItemID)
+bool AHydroGrowCharacter::RemoveItem(FName ItemID, int32 Quantity)
 {
 	if (HasAuthority())
 	{
-		return InventoryItems.RemoveSingle(ItemID) > 0;
+		return Inventory.RemoveQuantity(ItemID, Quantity);
 	}
 	return false;
 }
 
 int32 AHydroGrowCharacter::GetItemCount(FName ItemID) const
 {
-	int32 Count = 0;
-	for (const FName& Item : InventoryItems)
+	return Inventory.GetQuantity(ItemID);
+}
+
+void AHydroGrowCharacter::SaveInventory(UHydroGrowSaveGame* SaveGame) const
+{
+	if (SaveGame)
+	{
+		SaveGame->InventoryStacks.Reset(Inventory.Num());
+		for (const FInventoryEntry& Entry : Inventory.GetItems())
+		{
+			SaveGame->InventoryStacks.Add(Entry.Stack);
+		}
+	}
+}
+
+void AHydroGrowCharacter::LoadInventory(const UHydroGrowSaveGame* SaveGame)
+{
+	if (HasAuthority() && SaveGame)
 	{
-		if (Item == ItemID)
+		Inventory.Reset();
+		for (const FInventoryItemData& Stack : SaveGame->InventoryStacks)
 		{
-			Count++;
+			Inventory.AddQuantity(Stack.ItemID, Stack.Quantity, Stack.ItemType);
 		}
 	}
-	return Count;
 }
 
 void AHydroGrowCharacter::CheckLevelUp()
@@ -0,0 +1,218 @@
+#include "Player/InteractionQuerySubsystem.h"
+#include "Player/HydroGrowCharacter.h"
+#include "Components/InteractionComponent.h"
+#include "Camera/CameraComponent.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+
+UInteractionQuerySubsystem::UInteractionQuerySubsystem()
+{
+	QueryInterval = 0.0f;
+	MaxSightTracesPerQuery = 4;
+	SightRecheckDistance = 20.0f;
+	SightRecheckInterval = 0.5f;
+	TimeSinceQuery = 0.0f;
+}
+
+void UInteractionQuerySubsystem::Deinitialize()
+{
+	SightTraces.Empty();
+	SightCache.Empty();
+	Candidates.Empty();
+	Visible.Empty();
+	Target.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UInteractionQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionQuerySubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UInteractionQuerySubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Always;
+}
+
+UWorld* UInteractionQuerySubsystem::GetTickableGameObjectWorld() const
+{
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	return LocalPlayer ? LocalPlayer->GetWorld() : nullptr;
+}
+
+void UInteractionQuerySubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetTickableGameObjectWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Async results only survive one frame, so read them every tick whether or not a query runs
+	ConsumeTraces(World);
+
+	TimeSinceQuery += DeltaTime;
+	if (TimeSinceQuery < QueryInterval)
+	{
+		return;
+	}
+	TimeSinceQuery = 0.0f;
+
+	const APlayerController* PlayerController = GetLocalPlayer()->GetPlayerController(World);
+	AHydroGrowCharacter* Character = PlayerController ? Cast<AHydroGrowCharacter>(PlayerController->GetPawn()) : nullptr;
+	UInteractionComponent* Interaction = Character ? Character->FindComponentByClass<UInteractionComponent>() : nullptr;
+
+	if (!Interaction)
+	{
+		// Unpossessed or spectating: nothing cached applies to the next pawn
+		ViewedActor.Reset();
+		SightCache.Reset();
+		Target.Reset();
+		return;
+	}
+
+	RunQuery(World, Character, Interaction);
+}
+
+void UInteractionQuerySubsystem::ConsumeTraces(UWorld* World)
+{
+	FTraceDatum Datum;
+	if (ViewTrace.IsValid())
+	{
+		ViewedActor.Reset();
+		if (World->QueryTraceData(ViewTrace, Datum))
+		{
+			if (const FHitResult* Hit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; }))
+			{
+				ViewedActor = Hit->GetActor();
+			}
+		}
+		ViewTrace = FTraceHandle();
+	}
+
+	for (FSightTrace& Trace : SightTraces)
+	{
+		if (!Trace.Actor.IsValid() || !World->QueryTraceData(Trace.Handle, Datum))
+		{
+			continue;
+		}
+
+		// Owner and target are ignored, so any blocking hit is an obstruction
+		Trace.Result.bVisible = !Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+		SightCache.Add(Trace.Actor, Trace.Result);
+	}
+	SightTraces.Reset();
+}
+
+void UInteractionQuerySubsystem::RunQuery(UWorld* World, AHydroGrowCharacter* Character, UInteractionComponent* Interaction)
+{
+	Interaction->GatherCandidates(Candidates);
+
+	// Results for actors that left range or cone are dropped; they are retraced if they return
+	for (auto It = SightCache.CreateIterator(); It; ++It)
+	{
+		if (!Candidates.Contains(It.Key().Get()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	Visible.Reset();
+	if (Interaction->RequiresLineOfSight())
+	{
+		for (AActor* Actor : Candidates)
+		{
+			const FSightResult* Result = SightCache.Find(Actor);
+			if (Result && Result->bVisible)
+			{
+				Visible.Add(Actor);
+			}
+		}
+	}
+	else
+	{
+		Visible.Append(Candidates);
+	}
+
+	AActor* NewTarget = ViewedActor.Get();
+	if (!NewTarget || !Interaction->CanInteractWithActor(NewTarget))
+	{
+		NewTarget = nullptr;
+		float BestScore = TNumericLimits<float>::Lowest();
+		for (AActor* Actor : Visible)
+		{
+			const float Score = Interaction->ScoreCandidate(Actor);
+			if (Score > BestScore)
+			{
+				BestScore = Score;
+				NewTarget = Actor;
+			}
+		}
+	}
+
+	Target = NewTarget;
+	Interaction->ApplyQueryResult(NewTarget, Visible);
+
+	IssueTraces(World, Character, Interaction);
+}
+
+bool UInteractionQuerySubsystem::NeedsSightTrace(AActor* Actor, const FVector& Origin, double Now) const
+{
+	const FSightResult* Result = SightCache.Find(Actor);
+	if (!Result)
+	{
+		return true;
+	}
+
+	const float RecheckDistanceSquared = FMath::Square(SightRecheckDistance);
+	return Now - Result->Time >= SightRecheckInterval
+		|| FVector::DistSquared(Result->Origin, Origin) > RecheckDistanceSquared
+		|| FVector::DistSquared(Result->TargetLocation, Actor->GetActorLocation()) > RecheckDistanceSquared;
+}
+
+void UInteractionQuerySubsystem::IssueTraces(UWorld* World, AHydroGrowCharacter* Character, UInteractionComponent* Interaction)
+{
+	if (const UCameraComponent* Camera = Character->GetThirdPersonCameraComponent())
+	{
+		const FCollisionQueryParams ViewParams(SCENE_QUERY_STAT(InteractionView), false, Character);
+		const FVector Start = Camera->GetComponentLocation();
+		const FVector End = Start + Camera->GetForwardVector() * Character->GetInteractionRange();
+		ViewTrace = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, ECC_Visibility, ViewParams);
+	}
+
+	if (!Interaction->RequiresLineOfSight())
+	{
+		return;
+	}
+
+	const FVector Origin = Interaction->GetLineOfSightOrigin();
+	const double Now = World->GetTimeSeconds();
+
+	TraceQueue.Reset();
+	for (AActor* Actor : Candidates)
+	{
+		if (NeedsSightTrace(Actor, Origin, Now))
+		{
+			TraceQueue.Emplace(Interaction->ScoreCandidate(Actor), Actor);
+		}
+	}
+
+	// Spend the budget on the candidates most likely to become the target
+	TraceQueue.Sort([](const TPair<float, AActor*>& A, const TPair<float, AActor*>& B) { return A.Key > B.Key; });
+	const int32 NumTraces = FMath::Min(TraceQueue.Num(), MaxSightTracesPerQuery);
+
+	for (int32 i = 0; i < NumTraces; i++)
+	{
+		AActor* Actor = TraceQueue[i].Value;
+		FCollisionQueryParams SightParams(SCENE_QUERY_STAT(InteractionSight), false, Character);
+		SightParams.AddIgnoredActor(Actor);
+
+		FSightTrace& Trace = SightTraces.AddDefaulted_GetRef();
+		Trace.Actor = Actor;
+		Trace.Result.Origin = Origin;
+		Trace.Result.TargetLocation = Actor->GetActorLocation();
+		Trace.Result.Time = Now;
+		Trace.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Origin, Trace.Result.TargetLocation, ECC_Visibility, SightParams);
+	}
+}
@@ -0,0 +1,175 @@
+#include "Systems/ConditionTelemetrySubsystem.h"
+#include "Systems/HydroponicsContainer.h"
+#include "Systems/TimeManager.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "EngineUtils.h"
+
+static FAutoConsoleCommandWithWorldAndArgs TelemetryStatsCommand(
+	TEXT("HydroGrow.Telemetry.Stats"),
+	TEXT("Print the number of recorded container histories and their memory use"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UConditionTelemetrySubsystem* Telemetry = UConditionTelemetrySubsystem::Get(World))
+		{
+			Telemetry->LogStats();
+		}
+	}));
+
+UConditionTelemetrySubsystem::UConditionTelemetrySubsystem()
+{
+	SampleIntervalHours = 1.0f;
+	MaxBlocksPerContainer = 64;
+	NextSampleTicks = 0;
+	TimeManager = nullptr;
+}
+
+UConditionTelemetrySubsystem* UConditionTelemetrySubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UConditionTelemetrySubsystem>() : nullptr;
+}
+
+bool UConditionTelemetrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UConditionTelemetrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TimeManager = InWorld.GetGameInstance() ? InWorld.GetGameInstance()->GetSubsystem<UTimeManager>() : nullptr;
+	if (TimeManager)
+	{
+		StepCompleteHandle = TimeManager->OnSimulationStepComplete.AddUObject(this, &UConditionTelemetrySubsystem::OnSimulationStepComplete);
+	}
+}
+
+void UConditionTelemetrySubsystem::Deinitialize()
+{
+	if (TimeManager)
+	{
+		TimeManager->OnSimulationStepComplete.Remove(StepCompleteHandle);
+		TimeManager = nullptr;
+	}
+
+	Histories.Empty();
+
+	Super::Deinitialize();
+}
+
+void UConditionTelemetrySubsystem::OnSimulationStepComplete(const FSimulationStepContext& Step)
+{
+	const int64 GameTicks = TimeManager->GetGameTicks();
+	const int64 IntervalTicks = FMath::Max<int64>(1, static_cast<int64>(SampleIntervalHours * FGameDateTime::TicksPerHour));
+
+	// The clock jumped back (a save was loaded): the recorded history no longer applies
+	if (GameTicks + IntervalTicks < NextSampleTicks)
+	{
+		Histories.Empty();
+		NextSampleTicks = 0;
+	}
+
+	if (GameTicks < NextSampleTicks)
+	{
+		return;
+	}
+
+	// Aligned to the interval, so samples land on the same game times however steps are sized
+	NextSampleTicks = (GameTicks / IntervalTicks + 1) * IntervalTicks;
+	SampleContainers(GameTicks / FGameDateTime::TicksPerSecond);
+}
+
+void UConditionTelemetrySubsystem::SampleContainers(int64 GameSeconds)
+{
+	for (auto It = Histories.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (TActorIterator<AHydroponicsContainer> It(GetWorld()); It; ++It)
+	{
+		AHydroponicsContainer* Container = *It;
+		const FEnvironmentalConditions& Conditions = Container->GetEnvironmentalConditions();
+		const FNutrientLevels& Nutrients = Container->GetNutrientSolution();
+
+		// Order must match ETelemetryChannel
+		const float Values[FTelemetrySeries::NumChannels] =
+		{
+			Conditions.PHLevel, Conditions.ECLevel, Conditions.Temperature, Conditions.OxygenLevel, Conditions.WaterLevel,
+			Nutrients.Nitrogen, Nutrients.Phosphorus, Nutrients.Potassium
+		};
+
+		FTelemetrySeries* Series = Histories.Find(Container);
+		if (!Series)
+		{
+			Series = &Histories.Add(Container, FTelemetrySeries(MaxBlocksPerContainer));
+		}
+		Series->Append(GameSeconds, Values);
+	}
+}
+
+TArray<FTelemetryPoint> UConditionTelemetrySubsystem::QueryHistory(AHydroponicsContainer* Container, ETelemetryChannel Channel, float StartGameHour, float EndGameHour, int32 NumPoints) const
+{
+	TArray<FTelemetryPoint> Points;
+	const FTelemetrySeries* Series = Histories.Find(Container);
+	if (!Series || NumPoints <= 0 || EndGameHour <= StartGameHour)
+	{
+		return Points;
+	}
+
+	const int64 StartSeconds = static_cast<int64>(static_cast<double>(StartGameHour) * 3600.0);
+	const int64 EndSeconds = static_cast<int64>(static_cast<double>(EndGameHour) * 3600.0);
+
+	TArray<FTelemetryAggregate, TInlineAllocator<128>> Buckets;
+	Buckets.SetNum(NumPoints);
+	Series->Downsample(static_cast<int32>(Channel), StartSeconds, EndSeconds, Buckets);
+
+	Points.SetNum(NumPoints);
+	const float HoursPerPoint = (EndGameHour - StartGameHour) / NumPoints;
+	for (int32 i = 0; i < NumPoints; i++)
+	{
+		const FTelemetryAggregate& Bucket = Buckets[i];
+		FTelemetryPoint& Point = Points[i];
+		Point.GameHour = StartGameHour + HoursPerPoint * i;
+		Point.SampleCount = Bucket.Count;
+		if (Bucket.Count > 0)
+		{
+			Point.Min = Bucket.Min;
+			Point.Max = Bucket.Max;
+			Point.Mean = static_cast<float>(Bucket.Sum / Bucket.Count);
+		}
+	}
+
+	return Points;
+}
+
+int64 UConditionTelemetrySubsystem::GetMemoryBytes() const
+{
+	int64 Bytes = Histories.GetAllocatedSize();
+	for (const TPair<TWeakObjectPtr<AHydroponicsContainer>, FTelemetrySeries>& History : Histories)
+	{
+		Bytes += History.Value.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+void UConditionTelemetrySubsystem::LogStats() const
+{
+	int64 SampleCount = 0;
+	double RecordedDays = 0.0;
+	for (const TPair<TWeakObjectPtr<AHydroponicsContainer>, FTelemetrySeries>& History : Histories)
+	{
+		SampleCount += History.Value.GetNumSamples();
+		RecordedDays += static_cast<double>(History.Value.GetLastTime() - History.Value.GetFirstTime()) / 86400.0;
+	}
+
+	const int64 Bytes = GetMemoryBytes();
+	UE_LOG(LogTemp, Display, TEXT("Telemetry: %d containers, %lld samples, %lld bytes (%.0f bytes per container-day)"),
+		Histories.Num(), SampleCount, Bytes, RecordedDays > 0.0 ? Bytes / RecordedDays : 0.0);
+}
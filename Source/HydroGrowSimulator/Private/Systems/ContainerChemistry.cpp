@@ -0,0 +1,95 @@
+#include "Systems/ContainerChemistry.h"
+#include "Systems/SimulationRandom.h"
+
+namespace ContainerChemistry
+{
+	static void SimulatePHDrift(FContainerChemistryState& State, float DeltaTime, int64 StepIndex)
+	{
+		// pH naturally drifts over time based on plant uptake and system type
+		float DriftRate = 0.1f; // pH units per day
+
+		// Random walk: scale the noise so one long step has the same spread as many one-second steps
+		const float Noise = SimulationRandom::SignedUniform(State.RandomStream, StepIndex, SimulationRandom::EStreamPurpose::PHDrift);
+		float DriftDirection = Noise * FMath::Sqrt(FMath::Min(1.0f, 1.0f / FMath::Max(DeltaTime, UE_KINDA_SMALL_NUMBER)));
+
+		// Plants affect pH through nutrient uptake (pH units per day)
+		float PlantEffect = State.PlantCount * 0.02f;
+
+		State.PHLevel += (DriftDirection * DriftRate + PlantEffect) * DeltaTime / 86400.0f;
+		State.PHLevel = FMath::Clamp(State.PHLevel, 4.0f, 8.0f);
+	}
+
+	static void SimulateNutrientDepletion(FContainerChemistryState& State, float DeltaTime)
+	{
+		// Plants consume nutrients over time (0.2 units per plant per game day)
+		float ConsumptionRate = State.PlantCount * 0.2f * DeltaTime / 86400.0f;
+
+		State.Nitrogen = FMath::Max(State.Nitrogen - ConsumptionRate, 0.0f);
+		State.Phosphorus = FMath::Max(State.Phosphorus - ConsumptionRate * 0.8f, 0.0f);
+		State.Potassium = FMath::Max(State.Potassium - ConsumptionRate * 1.2f, 0.0f);
+
+		// Update EC based on remaining nutrients
+		float TotalNutrients = (State.Nitrogen + State.Phosphorus + State.Potassium) / 3.0f;
+		State.ECLevel = TotalNutrients * 1.5f;
+	}
+
+	static void SimulateWaterEvaporation(FContainerChemistryState& State, float DeltaTime)
+	{
+		const float StartLevel = State.WaterLevel;
+		State.WaterLevel = FMath::Max(State.WaterLevel - EvaporationPerSecond * DeltaTime, 0.0f);
+
+		// Low water levels affect other conditions
+		if (State.WaterLevel < LowWaterLevel)
+		{
+			// Only the part of the step spent below the low level counts
+			float LowSeconds = DeltaTime;
+			if (StartLevel >= LowWaterLevel)
+			{
+				LowSeconds *= (LowWaterLevel - State.WaterLevel) / FMath::Max(StartLevel - State.WaterLevel, UE_KINDA_SMALL_NUMBER);
+				State.Alerts |= EContainerChemistryAlert::LowWater;
+			}
+
+			// Concentrated nutrients
+			State.ECLevel *= 1.1f;
+
+			// Reduced oxygen (10% per game hour)
+			State.OxygenLevel *= FMath::Pow(0.9f, LowSeconds / 3600.0f);
+		}
+	}
+
+	static void UpdateWaterSystem(FContainerChemistryState& State, float DeltaTime)
+	{
+		// Oxygen rates are per game hour
+		float Hours = DeltaTime / 3600.0f;
+
+		if (State.bPumpRunning)
+		{
+			// Pump maintains water circulation and oxygenation
+			State.OxygenLevel = FMath::Min(State.OxygenLevel + 0.1f * Hours, 1.5f);
+		}
+		else
+		{
+			// Oxygen levels drop without circulation
+			State.OxygenLevel = FMath::Max(State.OxygenLevel - 0.05f * Hours, 0.3f);
+		}
+	}
+
+	void Step(FContainerChemistryState& State, float DeltaTime, int64 StepIndex)
+	{
+		State.Alerts = EContainerChemistryAlert::None;
+
+		SimulatePHDrift(State, DeltaTime, StepIndex);
+		SimulateNutrientDepletion(State, DeltaTime);
+		SimulateWaterEvaporation(State, DeltaTime);
+		UpdateWaterSystem(State, DeltaTime);
+	}
+
+	double GetSecondsToNextAlert(const FContainerChemistryState& State)
+	{
+		if (State.WaterLevel >= LowWaterLevel)
+		{
+			return (State.WaterLevel - LowWaterLevel) / EvaporationPerSecond;
+		}
+		return TNumericLimits<double>::Max();
+	}
+}
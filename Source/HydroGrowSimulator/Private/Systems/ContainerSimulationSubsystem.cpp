@@ -0,0 +1,151 @@
+#include "Systems/ContainerSimulationSubsystem.h"
+#include "Systems/HydroponicsContainer.h"
+#include "Systems/TimeManager.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "Async/ParallelFor.h"
+
+UContainerSimulationSubsystem::UContainerSimulationSubsystem()
+{
+	MinBatchSize = 32;
+	bPlumbingDirty = true;
+	TimeManager = nullptr;
+}
+
+bool UContainerSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UContainerSimulationSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Chemistry is server authoritative
+	if (InWorld.GetNetMode() == NM_Client || !InWorld.GetGameInstance())
+	{
+		return;
+	}
+
+	TimeManager = InWorld.GetGameInstance()->GetSubsystem<UTimeManager>();
+	if (TimeManager)
+	{
+		SimulationStepHandle = TimeManager->OnSimulationStep.AddUObject(this, &UContainerSimulationSubsystem::SimulateStep);
+		PredictNextEventHandle = TimeManager->OnPredictNextEvent.AddUObject(this, &UContainerSimulationSubsystem::PredictNextEvent);
+	}
+}
+
+void UContainerSimulationSubsystem::Deinitialize()
+{
+	if (TimeManager)
+	{
+		TimeManager->OnSimulationStep.Remove(SimulationStepHandle);
+		TimeManager->OnPredictNextEvent.Remove(PredictNextEventHandle);
+		TimeManager = nullptr;
+	}
+
+	Containers.Empty();
+	States.Empty();
+
+	Super::Deinitialize();
+}
+
+void UContainerSimulationSubsystem::RegisterContainer(AHydroponicsContainer* Container)
+{
+	if (Container)
+	{
+		Containers.AddUnique(Container);
+		bPlumbingDirty = true;
+	}
+}
+
+void UContainerSimulationSubsystem::UnregisterContainer(AHydroponicsContainer* Container)
+{
+	if (Containers.RemoveSwap(Container, EAllowShrinking::No) > 0)
+	{
+		bPlumbingDirty = true;
+	}
+}
+
+void UContainerSimulationSubsystem::RebuildPlumbing()
+{
+	TMap<const AHydroponicsContainer*, int32> ContainerIndices;
+	ContainerIndices.Reserve(Containers.Num());
+	for (int32 i = 0; i < Containers.Num(); i++)
+	{
+		ContainerIndices.Add(Containers[i], i);
+	}
+
+	// Reservoirs that are not registered (e.g. destroyed) simply leave the container unplumbed
+	TArray<int32> SupplyIndex;
+	SupplyIndex.SetNumUninitialized(Containers.Num());
+	for (int32 i = 0; i < Containers.Num(); i++)
+	{
+		const int32* Found = ContainerIndices.Find(Containers[i]->GetSupplyReservoir());
+		SupplyIndex[i] = Found ? *Found : INDEX_NONE;
+	}
+
+	FlowNetwork.SetTopology(SupplyIndex);
+	bPlumbingDirty = false;
+}
+
+void UContainerSimulationSubsystem::SimulateStep(const FSimulationStepContext& Step)
+{
+	const int32 NumContainers = Containers.Num();
+	if (NumContainers == 0)
+	{
+		return;
+	}
+
+	// Gather into one contiguous buffer (game thread)
+	States.SetNum(NumContainers, EAllowShrinking::No);
+	for (int32 i = 0; i < NumContainers; i++)
+	{
+		Containers[i]->GatherChemistryState(States[i]);
+	}
+
+	// Exchange water and nutrients across the plumbing (one sparse solve for the whole world)
+	if (bPlumbingDirty)
+	{
+		RebuildPlumbing();
+	}
+	FlowNetwork.Step(States, Step.DeltaGameSeconds);
+
+	// Step every container on worker threads; the kernel only touches its own state
+	const float DeltaTime = Step.DeltaGameSeconds;
+	const int64 StepIndex = Step.StepIndex;
+	const EParallelForFlags Flags = NumContainers < MinBatchSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	ParallelFor(TEXT("ContainerChemistry"), NumContainers, MinBatchSize, [this, DeltaTime, StepIndex](int32 Index)
+	{
+		ContainerChemistry::Step(States[Index], DeltaTime, StepIndex);
+	}, Flags);
+
+	// Single write-back sync point (game thread)
+	bool bAlertRaised = false;
+	for (int32 i = 0; i < NumContainers; i++)
+	{
+		const FContainerChemistryState& State = States[i];
+		Containers[i]->ApplyChemistryState(State);
+
+		if (EnumHasAnyFlags(State.Alerts, EContainerChemistryAlert::LowWater))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Container %s: water level low (%.2f)"), *Containers[i]->GetName(), State.WaterLevel);
+			bAlertRaised = true;
+		}
+	}
+
+	if (bAlertRaised && TimeManager)
+	{
+		TimeManager->NotifySimulationEvent();
+	}
+}
+
+void UContainerSimulationSubsystem::PredictNextEvent(double& InOutSeconds) const
+{
+	// Uses the last stepped states; containers change little between a step and the next skip chunk
+	const int32 NumStates = FMath::Min(States.Num(), Containers.Num());
+	for (int32 i = 0; i < NumStates; i++)
+	{
+		InOutSeconds = FMath::Min(InOutSeconds, ContainerChemistry::GetSecondsToNextAlert(States[i]));
+	}
+}
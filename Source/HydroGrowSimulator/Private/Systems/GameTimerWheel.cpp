@@ -0,0 +1,432 @@
+#include "Systems/GameTimerWheel.h"
+#include "Misc/ScopeExit.h"
+
+FGameTimerWheel::FGameTimerWheel()
+{
+	FreeHead = INDEX_NONE;
+	NumScheduled = 0;
+	CurrentTick = 0;
+	bAdvancing = false;
+
+	Reset(0);
+}
+
+void FGameTimerWheel::Reset(uint64 StartTick)
+{
+	check(!bAdvancing);
+
+	// Retire live nodes through the free list so stale handles never match a reused node
+	for (int32 i = 0; i < Nodes.Num(); i++)
+	{
+		if (Nodes[i].List != FreeList)
+		{
+			FreeNode(i);
+		}
+	}
+
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		for (int32 Slot = 0; Slot < NumSlots; Slot++)
+		{
+			SlotHeads[Level][Slot] = INDEX_NONE;
+		}
+		for (int32 Word = 0; Word < WordsPerLevel; Word++)
+		{
+			Occupancy[Level][Word] = 0;
+		}
+	}
+
+	OverflowHead = INDEX_NONE;
+	DueHead = INDEX_NONE;
+	NumScheduled = 0;
+	CurrentTick = StartTick;
+}
+
+void FGameTimerWheel::Reserve(int32 NumTimers)
+{
+	const int32 OldNum = Nodes.Num();
+	if (NumTimers <= OldNum)
+	{
+		return;
+	}
+
+	Nodes.AddDefaulted(NumTimers - OldNum);
+
+	// Thread the new nodes onto the free list in index order
+	for (int32 i = NumTimers - 1; i >= OldNum; i--)
+	{
+		Nodes[i].Next = FreeHead;
+		FreeHead = i;
+	}
+}
+
+FGameTimerHandle FGameTimerWheel::Schedule(uint64 DeadlineTick, FSimpleDelegate Callback)
+{
+	const int32 Index = AllocateNode();
+
+	FTimerNode& Node = Nodes[Index];
+	Node.Deadline = FMath::Max(DeadlineTick, CurrentTick + 1);
+	Node.Callback = MoveTemp(Callback);
+	Place(Index);
+
+	NumScheduled++;
+
+	FGameTimerHandle Handle;
+	Handle.Handle = (static_cast<uint64>(Node.Generation) << 32) | static_cast<uint64>(Index + 1);
+	return Handle;
+}
+
+bool FGameTimerWheel::Cancel(FGameTimerHandle& Handle)
+{
+	const int32 Index = ResolveHandle(Handle);
+	Handle.Invalidate();
+
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Unlink(Index);
+	FreeNode(Index);
+	return true;
+}
+
+bool FGameTimerWheel::IsScheduled(const FGameTimerHandle& Handle) const
+{
+	return ResolveHandle(Handle) != INDEX_NONE;
+}
+
+bool FGameTimerWheel::GetDeadline(const FGameTimerHandle& Handle, uint64& OutDeadlineTick) const
+{
+	const int32 Index = ResolveHandle(Handle);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutDeadlineTick = Nodes[Index].Deadline;
+	return true;
+}
+
+bool FGameTimerWheel::PeekNextDeadline(uint64& OutDeadlineTick) const
+{
+	if (DueHead != INDEX_NONE)
+	{
+		OutDeadlineTick = CurrentTick;
+		return true;
+	}
+
+	// Same search as Advance: the first occupied slot ahead on the lowest level holds the minimum
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		const int32 CurrentSlot = static_cast<int32>((CurrentTick >> (SlotBits * Level)) & SlotMask);
+		const int32 Slot = FindOccupiedSlot(Level, CurrentSlot + 1);
+		if (Slot != INDEX_NONE)
+		{
+			OutDeadlineTick = GetListMinDeadline(SlotHeads[Level][Slot]);
+			return true;
+		}
+	}
+
+	if (OverflowHead != INDEX_NONE)
+	{
+		OutDeadlineTick = GetListMinDeadline(OverflowHead);
+		return true;
+	}
+
+	return false;
+}
+
+int32 FGameTimerWheel::Advance(uint64 TargetTick)
+{
+	return Advance(TargetTick, [](uint64) {});
+}
+
+int32 FGameTimerWheel::Advance(uint64 TargetTick, TFunctionRef<void(uint64)> OnReachTick)
+{
+	if (!ensureMsgf(!bAdvancing, TEXT("FGameTimerWheel::Advance called from inside a timer callback")))
+	{
+		return 0;
+	}
+
+	bAdvancing = true;
+	ON_SCOPE_EXIT
+	{
+		bAdvancing = false;
+	};
+
+	int32 Fired = 0;
+	while (CurrentTick < TargetTick)
+	{
+		// The lowest level with an occupied slot ahead of the current position holds the earliest deadline
+		int32 Level = 0;
+		int32 Slot = INDEX_NONE;
+		for (; Level < NumLevels; Level++)
+		{
+			const int32 CurrentSlot = static_cast<int32>((CurrentTick >> (SlotBits * Level)) & SlotMask);
+			Slot = FindOccupiedSlot(Level, CurrentSlot + 1);
+			if (Slot != INDEX_NONE)
+			{
+				break;
+			}
+		}
+
+		uint64 SlotStart = 0;
+		if (Slot != INDEX_NONE)
+		{
+			const int32 Shift = SlotBits * Level;
+			const int32 RotationShift = Shift + SlotBits;
+			SlotStart = ((CurrentTick >> RotationShift) << RotationShift) | (static_cast<uint64>(Slot) << Shift);
+		}
+		else if (OverflowHead != INDEX_NONE)
+		{
+			// Wheel is empty; the overflow list becomes reachable when the top level wraps
+			const int32 Shift = SlotBits * NumLevels;
+			SlotStart = ((CurrentTick >> Shift) + 1) << Shift;
+		}
+		else
+		{
+			break;
+		}
+
+		if (SlotStart > TargetTick)
+		{
+			break;
+		}
+
+		// Nothing is due before SlotStart, so jump there and pull the slot down a level.
+		// On level 0 that moves everything straight to the due list.
+		CurrentTick = SlotStart;
+		if (Slot != INDEX_NONE)
+		{
+			Cascade(static_cast<uint8>(Level), static_cast<uint8>(Slot));
+		}
+		else
+		{
+			Cascade(OverflowList, 0);
+		}
+
+		if (DueHead != INDEX_NONE)
+		{
+			OnReachTick(CurrentTick);
+			Fired += FireDue();
+		}
+	}
+
+	// Every remaining slot starts after TargetTick, so their placement stays valid
+	CurrentTick = FMath::Max(CurrentTick, TargetTick);
+	return Fired;
+}
+
+int32 FGameTimerWheel::AllocateNode()
+{
+	if (FreeHead == INDEX_NONE)
+	{
+		Reserve(FMath::Max(64, Nodes.Num() * 2));
+	}
+
+	const int32 Index = FreeHead;
+	FreeHead = Nodes[Index].Next;
+	Nodes[Index].Next = INDEX_NONE;
+	return Index;
+}
+
+void FGameTimerWheel::FreeNode(int32 Index)
+{
+	FTimerNode& Node = Nodes[Index];
+	Node.Callback.Unbind();
+	Node.List = FreeList;
+	Node.Prev = INDEX_NONE;
+	Node.Next = FreeHead;
+
+	// Generation 0 is reserved so a default handle never resolves
+	Node.Generation++;
+	if (Node.Generation == 0)
+	{
+		Node.Generation = 1;
+	}
+
+	FreeHead = Index;
+	NumScheduled--;
+}
+
+int32 FGameTimerWheel::ResolveHandle(const FGameTimerHandle& Handle) const
+{
+	const int32 Index = static_cast<int32>(Handle.Handle & 0xFFFFFFFF) - 1;
+	const uint32 Generation = static_cast<uint32>(Handle.Handle >> 32);
+
+	if (!Nodes.IsValidIndex(Index))
+	{
+		return INDEX_NONE;
+	}
+
+	const FTimerNode& Node = Nodes[Index];
+	return (Node.List != FreeList && Node.Generation == Generation) ? Index : INDEX_NONE;
+}
+
+int32& FGameTimerWheel::GetListHead(uint8 List, uint8 Slot)
+{
+	if (List < NumLevels)
+	{
+		return SlotHeads[List][Slot];
+	}
+	return List == OverflowList ? OverflowHead : DueHead;
+}
+
+uint64 FGameTimerWheel::GetListMinDeadline(int32 Head) const
+{
+	uint64 MinDeadline = MAX_uint64;
+	int32 Index = Head;
+	do
+	{
+		MinDeadline = FMath::Min(MinDeadline, Nodes[Index].Deadline);
+		Index = Nodes[Index].Next;
+	}
+	while (Index != Head);
+	return MinDeadline;
+}
+
+void FGameTimerWheel::LinkTail(int32& Head, int32 Index)
+{
+	FTimerNode& Node = Nodes[Index];
+	if (Head == INDEX_NONE)
+	{
+		Head = Index;
+		Node.Prev = Index;
+		Node.Next = Index;
+		return;
+	}
+
+	const int32 Tail = Nodes[Head].Prev;
+	Node.Prev = Tail;
+	Node.Next = Head;
+	Nodes[Tail].Next = Index;
+	Nodes[Head].Prev = Index;
+}
+
+void FGameTimerWheel::Unlink(int32 Index)
+{
+	FTimerNode& Node = Nodes[Index];
+	int32& Head = GetListHead(Node.List, Node.Slot);
+
+	if (Node.Next == Index)
+	{
+		Head = INDEX_NONE;
+	}
+	else
+	{
+		Nodes[Node.Prev].Next = Node.Next;
+		Nodes[Node.Next].Prev = Node.Prev;
+		if (Head == Index)
+		{
+			Head = Node.Next;
+		}
+	}
+
+	if (Node.List < NumLevels && Head == INDEX_NONE)
+	{
+		Occupancy[Node.List][Node.Slot >> 6] &= ~(1ull << (Node.Slot & 63));
+	}
+
+	Node.Prev = INDEX_NONE;
+	Node.Next = INDEX_NONE;
+}
+
+void FGameTimerWheel::Place(int32 Index)
+{
+	FTimerNode& Node = Nodes[Index];
+
+	if (Node.Deadline <= CurrentTick)
+	{
+		Node.List = DueList;
+		Node.Slot = 0;
+		LinkTail(DueHead, Index);
+		return;
+	}
+
+	// Lowest level whose rotation contains both the current tick and the deadline
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		const int32 RotationShift = SlotBits * (Level + 1);
+		if ((Node.Deadline >> RotationShift) == (CurrentTick >> RotationShift))
+		{
+			const uint8 Slot = static_cast<uint8>((Node.Deadline >> (SlotBits * Level)) & SlotMask);
+			Node.List = static_cast<uint8>(Level);
+			Node.Slot = Slot;
+			LinkTail(SlotHeads[Level][Slot], Index);
+			Occupancy[Level][Slot >> 6] |= 1ull << (Slot & 63);
+			return;
+		}
+	}
+
+	Node.List = OverflowList;
+	Node.Slot = 0;
+	LinkTail(OverflowHead, Index);
+}
+
+void FGameTimerWheel::Cascade(uint8 List, uint8 Slot)
+{
+	int32& Head = GetListHead(List, Slot);
+	const int32 First = Head;
+	if (First == INDEX_NONE)
+	{
+		return;
+	}
+
+	Head = INDEX_NONE;
+	if (List < NumLevels)
+	{
+		Occupancy[List][Slot >> 6] &= ~(1ull << (Slot & 63));
+	}
+
+	// Walk the detached ring; links of nodes not yet visited are untouched by Place
+	int32 Index = First;
+	do
+	{
+		const int32 Next = Nodes[Index].Next;
+		Place(Index);
+		Index = Next;
+	}
+	while (Index != First);
+}
+
+int32 FGameTimerWheel::FindOccupiedSlot(int32 Level, int32 FromSlot) const
+{
+	if (FromSlot >= NumSlots)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Word = FromSlot >> 6;
+	uint64 Bits = Occupancy[Level][Word] & (~0ull << (FromSlot & 63));
+	while (true)
+	{
+		if (Bits != 0)
+		{
+			return Word * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Bits));
+		}
+
+		if (++Word >= WordsPerLevel)
+		{
+			return INDEX_NONE;
+		}
+		Bits = Occupancy[Level][Word];
+	}
+}
+
+int32 FGameTimerWheel::FireDue()
+{
+	int32 Fired = 0;
+	while (DueHead != INDEX_NONE)
+	{
+		// Release the node before running the callback; it may schedule or cancel other timers
+		const int32 Index = DueHead;
+		Unlink(Index);
+		FSimpleDelegate Callback = MoveTemp(Nodes[Index].Callback);
+		FreeNode(Index);
+
+		Callback.ExecuteIfBound();
+		Fired++;
+	}
+	return Fired;
+}
@@ -0,0 +1,380 @@
+#include "Systems/HydroFlowNetwork.h"
+#include "Systems/ContainerChemistry.h"
+
+namespace
+{
+	// Token volume (litres) given to empty containers for nutrient transport. It is added to both
+	// the old and new volume, so it keeps the system well posed without creating or losing mass.
+	constexpr double MinTransportVolume = 1.0e-3;
+}
+
+FHydroFlowNetwork::FHydroFlowNetwork()
+{
+	Tolerance = 1.0e-6;
+	MaxIterations = 100;
+	NumNodes = 0;
+	LastIterations = 0;
+}
+
+void FHydroFlowNetwork::SetTopology(const TArray<int32>& SupplyIndex)
+{
+	NumNodes = SupplyIndex.Num();
+
+	EdgeNodes.Reset();
+	EdgeSupply.Reset();
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		const int32 Supply = SupplyIndex[i];
+		if (Supply != INDEX_NONE && Supply != i && SupplyIndex.IsValidIndex(Supply))
+		{
+			EdgeNodes.Add(i);
+			EdgeSupply.Add(Supply);
+		}
+	}
+
+	// Count entries per row, then fill in place
+	RowStart.Init(0, NumNodes + 1);
+	for (int32 e = 0; e < EdgeNodes.Num(); e++)
+	{
+		RowStart[EdgeNodes[e] + 1]++;
+		RowStart[EdgeSupply[e] + 1]++;
+	}
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		RowStart[i + 1] += RowStart[i];
+	}
+
+	const int32 NumEntries = RowStart[NumNodes];
+	ColIndex.SetNumUninitialized(NumEntries);
+	OffDiagEdge.SetNumUninitialized(NumEntries);
+
+	TArray<int32> RowFill(RowStart.GetData(), NumNodes);
+	for (int32 e = 0; e < EdgeNodes.Num(); e++)
+	{
+		const int32 Node = EdgeNodes[e];
+		const int32 Supply = EdgeSupply[e];
+
+		ColIndex[RowFill[Node]] = Supply;
+		OffDiagEdge[RowFill[Node]++] = e;
+
+		ColIndex[RowFill[Supply]] = Node;
+		OffDiagEdge[RowFill[Supply]++] = e;
+	}
+
+	EdgeWeight.SetNumZeroed(EdgeNodes.Num());
+	EdgeFlow.SetNumZeroed(EdgeNodes.Num());
+	OffDiagValue.SetNumZeroed(NumEntries);
+	Diagonal.SetNumZeroed(NumNodes);
+	OldVolume.SetNumZeroed(NumNodes);
+	NewVolume.SetNumZeroed(NumNodes);
+	X.SetNumZeroed(NumNodes);
+	B.SetNumZeroed(NumNodes);
+	R.SetNumZeroed(NumNodes);
+	Z.SetNumZeroed(NumNodes);
+	P.SetNumZeroed(NumNodes);
+	AP.SetNumZeroed(NumNodes);
+	RHat.SetNumZeroed(NumNodes);
+	SHat.SetNumZeroed(NumNodes);
+	T.SetNumZeroed(NumNodes);
+}
+
+void FHydroFlowNetwork::Step(TArrayView<FContainerChemistryState> States, float DeltaTime)
+{
+	if (!ensure(States.Num() == NumNodes) || EdgeNodes.Num() == 0 || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// Conductance is litres per game hour; pumps that are off contribute nothing
+	const double StepHours = DeltaTime / 3600.0;
+	bool bAnyFlow = false;
+	for (int32 e = 0; e < EdgeNodes.Num(); e++)
+	{
+		EdgeWeight[e] = FMath::Max(States[EdgeNodes[e]].FlowConductance, 0.0f) * StepHours;
+		bAnyFlow |= EdgeWeight[e] > 0.0;
+	}
+	if (!bAnyFlow)
+	{
+		return;
+	}
+
+	// Water: unknown is level (fraction of capacity), volume matrix is capacity
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		const FContainerChemistryState& State = States[i];
+		const double Capacity = FMath::Max(State.WaterCapacity, 1.0f);
+		OldVolume[i] = Capacity * State.WaterLevel;
+		NewVolume[i] = Capacity;
+		B[i] = OldVolume[i];
+		X[i] = State.WaterLevel;
+	}
+	BuildSystem(NewVolume);
+	LastIterations = SolveConjugateGradient();
+
+	// Litres moved along each edge. New volumes are built from these flows rather than from the
+	// solved levels, so water is conserved exactly instead of to solver tolerance.
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		NewVolume[i] = OldVolume[i];
+	}
+	for (int32 e = 0; e < EdgeNodes.Num(); e++)
+	{
+		EdgeFlow[e] = EdgeWeight[e] * (X[EdgeSupply[e]] - X[EdgeNodes[e]]);
+		NewVolume[EdgeNodes[e]] += EdgeFlow[e];
+		NewVolume[EdgeSupply[e]] -= EdgeFlow[e];
+	}
+
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		FContainerChemistryState& State = States[i];
+		State.WaterLevel = static_cast<float>(NewVolume[i] / FMath::Max(State.WaterCapacity, 1.0f));
+
+		const double TokenVolume = FMath::Max(MinTransportVolume - OldVolume[i], 0.0);
+		OldVolume[i] += TokenVolume;
+		NewVolume[i] += TokenVolume;
+	}
+
+	// Nutrients: unknown is concentration, mass (volume * concentration) moves with the flow
+	BuildSystem(NewVolume);
+	AddAdvection();
+
+	float FContainerChemistryState::* const Nutrients[] =
+	{
+		&FContainerChemistryState::Nitrogen,
+		&FContainerChemistryState::Phosphorus,
+		&FContainerChemistryState::Potassium
+	};
+
+	for (float FContainerChemistryState::* Nutrient : Nutrients)
+	{
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			const double Concentration = States[i].*Nutrient;
+			B[i] = OldVolume[i] * Concentration;
+			X[i] = Concentration;
+		}
+
+		LastIterations = FMath::Max(LastIterations, SolveBiCGStab());
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			States[i].*Nutrient = static_cast<float>(X[i]);
+		}
+	}
+}
+
+void FHydroFlowNetwork::BuildSystem(const TArray<double>& Volume)
+{
+	// Edge weights already include the step length
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		Diagonal[i] = Volume[i];
+	}
+
+	for (int32 Entry = 0; Entry < OffDiagEdge.Num(); Entry++)
+	{
+		OffDiagValue[Entry] = -EdgeWeight[OffDiagEdge[Entry]];
+	}
+
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		for (int32 Entry = RowStart[i]; Entry < RowStart[i + 1]; Entry++)
+		{
+			Diagonal[i] -= OffDiagValue[Entry];
+		}
+	}
+}
+
+void FHydroFlowNetwork::AddAdvection()
+{
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		for (int32 Entry = RowStart[i]; Entry < RowStart[i + 1]; Entry++)
+		{
+			const int32 Edge = OffDiagEdge[Entry];
+			const double Inflow = ColIndex[Entry] == EdgeSupply[Edge] ? EdgeFlow[Edge] : -EdgeFlow[Edge];
+			if (Inflow > 0.0)
+			{
+				// Mass arriving at the neighbour's concentration
+				OffDiagValue[Entry] -= Inflow;
+			}
+			else
+			{
+				// Mass leaving at this node's own concentration
+				Diagonal[i] -= Inflow;
+			}
+		}
+	}
+}
+
+void FHydroFlowNetwork::Multiply(const TArray<double>& In, TArray<double>& Out) const
+{
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		double Sum = Diagonal[i] * In[i];
+		for (int32 Entry = RowStart[i]; Entry < RowStart[i + 1]; Entry++)
+		{
+			Sum += OffDiagValue[Entry] * In[ColIndex[Entry]];
+		}
+		Out[i] = Sum;
+	}
+}
+
+int32 FHydroFlowNetwork::SolveConjugateGradient()
+{
+	// r = b - Ax, z = M^-1 r, p = z
+	Multiply(X, AP);
+
+	double RhsNormSquared = 0.0;
+	double RZ = 0.0;
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		R[i] = B[i] - AP[i];
+		Z[i] = R[i] / Diagonal[i];
+		P[i] = Z[i];
+		RZ += R[i] * Z[i];
+		RhsNormSquared += B[i] * B[i];
+	}
+
+	const double StopNormSquared = FMath::Square(Tolerance) * FMath::Max(RhsNormSquared, UE_DOUBLE_SMALL_NUMBER);
+
+	int32 Iteration = 0;
+	for (; Iteration < MaxIterations; Iteration++)
+	{
+		double ResidualNormSquared = 0.0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			ResidualNormSquared += R[i] * R[i];
+		}
+		if (ResidualNormSquared <= StopNormSquared)
+		{
+			break;
+		}
+
+		Multiply(P, AP);
+
+		double PAP = 0.0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			PAP += P[i] * AP[i];
+		}
+		if (PAP <= 0.0)
+		{
+			break;
+		}
+
+		const double Alpha = RZ / PAP;
+		double NewRZ = 0.0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			X[i] += Alpha * P[i];
+			R[i] -= Alpha * AP[i];
+			Z[i] = R[i] / Diagonal[i];
+			NewRZ += R[i] * Z[i];
+		}
+
+		const double Beta = NewRZ / RZ;
+		RZ = NewRZ;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			P[i] = Z[i] + Beta * P[i];
+		}
+	}
+
+	return Iteration;
+}
+
+int32 FHydroFlowNetwork::SolveBiCGStab()
+{
+	// r = b - Ax, r^ = r, p = r
+	Multiply(X, AP);
+
+	double RhsNormSquared = 0.0;
+	double Rho = 0.0;
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		R[i] = B[i] - AP[i];
+		RHat[i] = R[i];
+		P[i] = R[i];
+		Rho += RHat[i] * R[i];
+		RhsNormSquared += B[i] * B[i];
+	}
+
+	const double StopNormSquared = FMath::Square(Tolerance) * FMath::Max(RhsNormSquared, UE_DOUBLE_SMALL_NUMBER);
+
+	int32 Iteration = 0;
+	for (; Iteration < MaxIterations; Iteration++)
+	{
+		double ResidualNormSquared = 0.0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			ResidualNormSquared += R[i] * R[i];
+		}
+		if (ResidualNormSquared <= StopNormSquared || Rho == 0.0)
+		{
+			break;
+		}
+
+		// z = M^-1 p, v = Az (kept in AP)
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			Z[i] = P[i] / Diagonal[i];
+		}
+		Multiply(Z, AP);
+
+		double RHatV = 0.0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			RHatV += RHat[i] * AP[i];
+		}
+		if (RHatV == 0.0)
+		{
+			break;
+		}
+
+		// s = r - alpha v (kept in R), s^ = M^-1 s, t = As^
+		const double Alpha = Rho / RHatV;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			X[i] += Alpha * Z[i];
+			R[i] -= Alpha * AP[i];
+			SHat[i] = R[i] / Diagonal[i];
+		}
+		Multiply(SHat, T);
+
+		double TT = 0.0;
+		double TS = 0.0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			TT += T[i] * T[i];
+			TS += T[i] * R[i];
+		}
+		if (TT == 0.0)
+		{
+			// s was already zero
+			break;
+		}
+
+		const double Omega = TS / TT;
+		double NewRho = 0.0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			X[i] += Omega * SHat[i];
+			R[i] -= Omega * T[i];
+			NewRho += RHat[i] * R[i];
+		}
+		if (Omega == 0.0)
+		{
+			break;
+		}
+
+		const double Beta = (NewRho / Rho) * (Alpha / Omega);
+		Rho = NewRho;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			P[i] = R[i] + Beta * (P[i] - Omega * AP[i]);
+		}
+	}
+
+	return Iteration;
+}
\ No newline at end of file
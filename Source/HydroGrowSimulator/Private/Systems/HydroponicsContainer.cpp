@@ -6,7 +6,16 @@
 #include "Engine/Engine.h"
 #include "Net/UnrealNetwork.h"
 #include "Network/HydroGrowNetworkGameMode.h"
+#include "Core/HydroGrowPlayerController.h"
+#include "Systems/ContainerChemistry.h"
+#include "Systems/ContainerSimulationSubsystem.h"
+#include "Systems/SimulationJournal.h"
+#include "Systems/SignificanceSubsystem.h"
+#include "Engine/GameInstance.h"
 #include "GameFramework/GameModeBase.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "TimerManager.h"
 
 // Network serialization for FPlantSlot
 bool FPlantSlot::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
@@ -21,12 +30,71 @@ bool FPlantSlot::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSu
 	return true;
 }
 
+FString FContainerEvent::ToString() const
+{
+	switch (Type)
+	{
+	case EContainerEventType::PlantAdded:
+		return FString::Printf(TEXT("Planted %s"), *Subject.ToString());
+	case EContainerEventType::PlantRemoved:
+		return TEXT("Removed plant");
+	case EContainerEventType::PHAdjusted:
+		return FString::Printf(TEXT("Adjusted pH to %.2f"), Value);
+	case EContainerEventType::ECAdjusted:
+		return FString::Printf(TEXT("Adjusted EC to %.2f"), Value);
+	case EContainerEventType::NutrientsAdded:
+		return TEXT("Added nutrients");
+	case EContainerEventType::PumpStarted:
+		return TEXT("Started water pump");
+	case EContainerEventType::PumpStopped:
+		return TEXT("Stopped water pump");
+	default:
+		return FString();
+	}
+}
+
+namespace
+{
+	// Plants replicate separately from their container, so a mismatch must outlast their update interval
+	constexpr double DivergenceConfirmSeconds = 1.0;
+
+	// Clients send commands through their own controller, the only actor they can call server RPCs on
+	bool SendPredictedAction(AHydroponicsContainer* Container, const FContainerActionRequest& Request, AHydroGrowPlayerController* InstigatingController)
+	{
+		AHydroGrowPlayerController* PlayerController = InstigatingController;
+		if (!PlayerController)
+		{
+			// Without an instigator the sender is only unambiguous when there is a single local player
+			UGameInstance* GameInstance = Container->GetGameInstance();
+			if (GameInstance && GameInstance->GetNumLocalPlayers() == 1)
+			{
+				PlayerController = Cast<AHydroGrowPlayerController>(GameInstance->GetFirstLocalPlayerController(Container->GetWorld()));
+			}
+		}
+		
+		if (!PlayerController || !PlayerController->IsLocalController())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("No local player controller to send %s to the server"), *UEnum::GetValueAsString(Request.Action));
+			return false;
+		}
+		
+		PlayerController->SendContainerAction(Container, Request);
+		return true;
+	}
+
+	int32 GetPlayerHandle(const AController* Controller)
+	{
+		return Controller && Controller->PlayerState ? Controller->PlayerState->GetPlayerId() : INDEX_NONE;
+	}
+}
+
 AHydroponicsContainer::AHydroponicsContainer()
 {
 	PrimaryActorTick.bCanEverTick = true;
 	bReplicates = true;
-	bAlwaysRelevant = true;
 	SetNetUpdateFrequency(10.0f);
+	SignificanceTier = ESignificanceTier::Near;
+	bSignificanceManaged = false;
 
 	// Create components
 	RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
@@ -48,11 +116,20 @@ AHydroponicsContainer::AHydroponicsContainer()
 	ContainerType = EContainerType::DWC;
 	bPumpRunning = false;
 	WaterFlowRate = 1.0f;
+	SupplyReservoir = nullptr;
+	SimulationID = 0;
 	EnergyConsumptionRate = 0.0f;
 	
 	// Network defaults
 	OwnerPlayerID = TEXT("");
 	bIsSharedContainer = false;
+	DivergenceCheckInterval = 5.0f;
+	bStateDigestDirty = true;
+	bDiverged = false;
+	DivergenceCount = 0;
+	MismatchStartTime = -1.0;
+	StateRevision = 0;
+	bAuthoritativePumpRunning = false;
 
 	// Configuration defaults
 	BaseEnergyConsumption = 10.0f;
@@ -92,49 +169,117 @@ void AHydroponicsContainer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	
 	DOREPLIFETIME_CONDITION(AHydroponicsContainer, ContainerType, COND_InitialOnly);
-	DOREPLIFETIME_CONDITION(AHydroponicsContainer, PlantSlots, COND_None);
-	DOREPLIFETIME_CONDITION(AHydroponicsContainer, CurrentConditions, COND_None);
-	DOREPLIFETIME_CONDITION(AHydroponicsContainer, NutrientSolution, COND_None);
-	DOREPLIFETIME_CONDITION(AHydroponicsContainer, bPumpRunning, COND_None);
+	
+	// Always notify: a prediction may already hold the incoming value, but the snapshot still has to be taken
+	DOREPLIFETIME_CONDITION_NOTIFY(AHydroponicsContainer, PlantSlots, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(AHydroponicsContainer, CurrentConditions, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(AHydroponicsContainer, NutrientSolution, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(AHydroponicsContainer, bPumpRunning, COND_None, REPNOTIFY_Always);
 	DOREPLIFETIME_CONDITION(AHydroponicsContainer, OwnerPlayerID, COND_InitialOnly);
 	DOREPLIFETIME_CONDITION(AHydroponicsContainer, bIsSharedContainer, COND_None);
+	DOREPLIFETIME_CONDITION(AHydroponicsContainer, StateDigest, COND_None);
+	DOREPLIFETIME_CONDITION(AHydroponicsContainer, PredictionAcks, COND_None);
 }
 
-bool AHydroponicsContainer::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+void AHydroponicsContainer::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
 {
-	// Always relevant for all players in multiplayer sessions
-	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+	Super::PreReplication(ChangedPropertyTracker);
+	
+	// Rebuilt here, not per step, so the digest always matches the state sent alongside it
+	if (bStateDigestDirty)
+	{
+		BuildStateDigest(StateDigest);
+		bStateDigestDirty = false;
+	}
 }
 
 void AHydroponicsContainer::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	// Visual updates move from Tick to the significance tiers
+	if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
+	{
+		Significance->RegisterContainer(this);
+		bSignificanceManaged = true;
+		SetActorTickEnabled(false);
+	}
+	
 	// Start with pump running for most container types (server only)
 	if (HasAuthority() && ContainerType != EContainerType::DWC)
 	{
 		StartWaterPump();
 	}
+	
+	// Only simulate on server; chemistry is stepped in batches with every other container
+	if (HasAuthority())
+	{
+		if (USimulationJournal* Journal = USimulationJournal::Get(this))
+		{
+			SimulationID = Journal->RegisterSimulationActor(this, SimulationID);
+		}
+		
+		if (UContainerSimulationSubsystem* Simulation = GetWorld()->GetSubsystem<UContainerSimulationSubsystem>())
+		{
+			Simulation->RegisterContainer(this);
+		}
+	}
+	else
+	{
+		// Properties still at their defaults are not in the initial bunch, so no OnRep has captured them
+		AuthoritativeSlots = PlantSlots;
+		AuthoritativeConditions = CurrentConditions;
+		AuthoritativeNutrients = NutrientSolution;
+		bAuthoritativePumpRunning = bPumpRunning;
+		
+		if (DivergenceCheckInterval > 0.0f)
+		{
+			// Catches local drift even when the server state (and so the digest) is unchanged
+			GetWorldTimerManager().SetTimer(DivergenceCheckTimer, this, &AHydroponicsContainer::CheckForDivergence, DivergenceCheckInterval, true);
+		}
+	}
 }
 
-void AHydroponicsContainer::Tick(float DeltaTime)
+void AHydroponicsContainer::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	GetWorldTimerManager().ClearTimer(DivergenceCheckTimer);
+	
+	if (bSignificanceManaged)
+	{
+		if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
+		{
+			Significance->Unregister(this);
+		}
+		bSignificanceManaged = false;
+	}
+	
+	if (UContainerSimulationSubsystem* Simulation = GetWorld() ? GetWorld()->GetSubsystem<UContainerSimulationSubsystem>() : nullptr)
+	{
+		Simulation->UnregisterContainer(this);
+	}
 	
-	// Only simulate on server
 	if (HasAuthority())
 	{
-		UpdateEnvironmentalConditions(DeltaTime);
-		UpdateWaterSystem(DeltaTime);
-		UpdatePlantConditions();
+		if (USimulationJournal* Journal = USimulationJournal::Get(this))
+		{
+			Journal->UnregisterSimulationActor(this, SimulationID);
+		}
 	}
 	
+	Super::EndPlay(EndPlayReason);
+}
+
+void AHydroponicsContainer::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	
 	// Visual effects on all clients
 	UpdateVisualEffects();
 }
 
 void AHydroponicsContainer::InitializeContainer(EContainerType Type, int32 PlantCapacity)
 {
+	bStateDigestDirty = true;
 	ContainerType = Type;
 	CreatePlantSlots(PlantCapacity);
 	
@@ -181,7 +326,7 @@ bool AHydroponicsContainer::CanPlantSeed(int32 SlotIndex) const
 	return !PlantSlots[SlotIndex].bIsOccupied;
 }
 
-bool AHydroponicsContainer::PlantSeed(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID)
+bool AHydroponicsContainer::PlantSeed(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID, AHydroGrowPlayerController* InstigatingController)
 {
 	// Check permissions first
 	if (!PlayerID.IsEmpty() && !CanPlayerInteract(PlayerID, EContainerPermission::PlantSeeds))
@@ -192,18 +337,28 @@ bool AHydroponicsContainer::PlantSeed(FName PlantSpeciesID, int32 SlotIndex, con
 	
 	if (HasAuthority())
 	{
-		Server_PlantSeed(PlantSpeciesID, SlotIndex, PlayerID);
+		ExecutePlantSeed(PlantSpeciesID, SlotIndex, PlayerID, GetPlayerHandle(InstigatingController));
 		return true;
 	}
 	else
 	{
-		Server_PlantSeed(PlantSpeciesID, SlotIndex, PlayerID);
-		return true; // Assume success on client
+		FContainerActionRequest Request(EContainerAction::PlantSeed);
+		Request.PlantSpeciesID = PlantSpeciesID;
+		Request.SlotIndex = SlotIndex;
+		return SendPredictedAction(this, Request, InstigatingController);
 	}
 }
 
-void AHydroponicsContainer::Server_PlantSeed_Implementation(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID)
+void AHydroponicsContainer::ExecutePlantSeed(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID, int32 PlayerHandle)
 {
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::PlantSeed, SimulationID, PlayerID);
+		Entry.Argument = PlantSpeciesID;
+		Entry.SlotIndex = SlotIndex;
+		Journal->Record(Entry);
+	}
+	
 	if (!CanPlantSeed(SlotIndex))
 	{
 		return;
@@ -223,20 +378,20 @@ void AHydroponicsContainer::Server_PlantSeed_Implementation(FName PlantSpeciesID
 		PlantSlots[SlotIndex].bIsOccupied = true;
 		PlantSlots[SlotIndex].PlantActor = NewPlant;
 		PlantSlots[SlotIndex].PlantedByPlayerID = PlayerID;
+		CommitCommand();
 		
 		OnPlantAdded.Broadcast(NewPlant);
-		OnContainerInteraction.Broadcast(PlayerID, FString::Printf(TEXT("Planted %s"), *PlantSpeciesID.ToString()));
 		
-		UE_LOG(LogTemp, Warning, TEXT("Player %s planted %s in slot %d"), *PlayerID, *PlantSpeciesID.ToString(), SlotIndex);
+		FContainerEvent Event(EContainerEventType::PlantAdded, PlayerHandle);
+		Event.Subject = PlantSpeciesID;
+		Event.SlotIndex = SlotIndex;
+		OnContainerInteraction.Broadcast(Event);
+		
+		UE_LOG(LogTemp, Verbose, TEXT("Player %s planted %s in slot %d"), *PlayerID, *PlantSpeciesID.ToString(), SlotIndex);
 	}
 }
 
-bool AHydroponicsContainer::Server_PlantSeed_Validate(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID)
-{
-	return true;
-}
-
-bool AHydroponicsContainer::RemovePlant(int32 SlotIndex, const FString& PlayerID)
+bool AHydroponicsContainer::RemovePlant(int32 SlotIndex, const FString& PlayerID, AHydroGrowPlayerController* InstigatingController)
 {
 	// Check permissions
 	if (!PlayerID.IsEmpty() && !CanPlayerInteract(PlayerID, EContainerPermission::HarvestPlants))
@@ -247,18 +402,26 @@ bool AHydroponicsContainer::RemovePlant(int32 SlotIndex, const FString& PlayerID
 	
 	if (HasAuthority())
 	{
-		Server_RemovePlant(SlotIndex, PlayerID);
+		ExecuteRemovePlant(SlotIndex, PlayerID, GetPlayerHandle(InstigatingController));
 		return true;
 	}
 	else
 	{
-		Server_RemovePlant(SlotIndex, PlayerID);
-		return true;
+		FContainerActionRequest Request(EContainerAction::RemovePlant);
+		Request.SlotIndex = SlotIndex;
+		return SendPredictedAction(this, Request, InstigatingController);
 	}
 }
 
-void AHydroponicsContainer::Server_RemovePlant_Implementation(int32 SlotIndex, const FString& PlayerID)
+void AHydroponicsContainer::ExecuteRemovePlant(int32 SlotIndex, const FString& PlayerID, int32 PlayerHandle)
 {
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::RemovePlant, SimulationID, PlayerID);
+		Entry.SlotIndex = SlotIndex;
+		Journal->Record(Entry);
+	}
+	
 	if (SlotIndex < 0 || SlotIndex >= PlantSlots.Num() || !PlantSlots[SlotIndex].bIsOccupied)
 	{
 		return;
@@ -272,14 +435,13 @@ void AHydroponicsContainer::Server_RemovePlant_Implementation(int32 SlotIndex, c
 	PlantSlots[SlotIndex].bIsOccupied = false;
 	PlantSlots[SlotIndex].PlantActor = nullptr;
 	PlantSlots[SlotIndex].PlantedByPlayerID = TEXT("");
+	CommitCommand();
 	
 	OnPlantRemoved.Broadcast(SlotIndex);
-	OnContainerInteraction.Broadcast(PlayerID, TEXT("Removed plant"));
-}
-
-bool AHydroponicsContainer::Server_RemovePlant_Validate(int32 SlotIndex, const FString& PlayerID)
-{
-	return true;
+	
+	FContainerEvent Event(EContainerEventType::PlantRemoved, PlayerHandle);
+	Event.SlotIndex = SlotIndex;
+	OnContainerInteraction.Broadcast(Event);
 }
 
 int32 AHydroponicsContainer::GetAvailableSlot() const
@@ -294,7 +456,7 @@ int32 AHydroponicsContainer::GetAvailableSlot() const
 	return -1;
 }
 
-void AHydroponicsContainer::SetPHLevel(float NewPH, const FString& PlayerID)
+void AHydroponicsContainer::SetPHLevel(float NewPH, const FString& PlayerID, AHydroGrowPlayerController* InstigatingController)
 {
 	if (!PlayerID.IsEmpty() && !CanPlayerInteract(PlayerID, EContainerPermission::AdjustEnvironment))
 	{
@@ -304,29 +466,35 @@ void AHydroponicsContainer::SetPHLevel(float NewPH, const FString& PlayerID)
 	
 	if (HasAuthority())
 	{
-		Server_SetPHLevel(NewPH, PlayerID);
+		ExecuteSetPHLevel(NewPH, PlayerID, GetPlayerHandle(InstigatingController));
 	}
 	else
 	{
-		Server_SetPHLevel(NewPH, PlayerID);
+		FContainerActionRequest Request(EContainerAction::SetPHLevel);
+		Request.Value = NewPH;
+		SendPredictedAction(this, Request, InstigatingController);
 	}
 }
 
-void AHydroponicsContainer::Server_SetPHLevel_Implementation(float NewPH, const FString& PlayerID)
+void AHydroponicsContainer::ExecuteSetPHLevel(float NewPH, const FString& PlayerID, int32 PlayerHandle)
 {
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::SetPHLevel, SimulationID, PlayerID);
+		Entry.Value = NewPH;
+		Journal->Record(Entry);
+	}
+	
 	CurrentConditions.PHLevel = FMath::Clamp(NewPH, 4.0f, 8.0f);
-	OnEnvironmentalChange.Broadcast(TEXT("pH"), CurrentConditions.PHLevel);
-	OnContainerInteraction.Broadcast(PlayerID, FString::Printf(TEXT("Adjusted pH to %.2f"), CurrentConditions.PHLevel));
+	CommitCommand();
+	static const FName PHParameter(TEXT("pH"));
+	OnEnvironmentalChange.Broadcast(PHParameter, CurrentConditions.PHLevel);
+	OnContainerInteraction.Broadcast(FContainerEvent(EContainerEventType::PHAdjusted, PlayerHandle, CurrentConditions.PHLevel));
 	
-	UE_LOG(LogTemp, Log, TEXT("Player %s adjusted pH to %.2f"), *PlayerID, CurrentConditions.PHLevel);
+	UE_LOG(LogTemp, Verbose, TEXT("Player %s adjusted pH to %.2f"), *PlayerID, CurrentConditions.PHLevel);
 }
 
-bool AHydroponicsContainer::Server_SetPHLevel_Validate(float NewPH, const FString& PlayerID)
-{
-	return NewPH >= 4.0f && NewPH <= 8.0f;
-}
-
-void AHydroponicsContainer::SetECLevel(float NewEC, const FString& PlayerID)
+void AHydroponicsContainer::SetECLevel(float NewEC, const FString& PlayerID, AHydroGrowPlayerController* InstigatingController)
 {
 	if (!PlayerID.IsEmpty() && !CanPlayerInteract(PlayerID, EContainerPermission::AdjustEnvironment))
 	{
@@ -336,35 +504,50 @@ void AHydroponicsContainer::SetECLevel(float NewEC, const FString& PlayerID)
 	
 	if (HasAuthority())
 	{
-		Server_SetECLevel(NewEC, PlayerID);
+		ExecuteSetECLevel(NewEC, PlayerID, GetPlayerHandle(InstigatingController));
 	}
 	else
 	{
-		Server_SetECLevel(NewEC, PlayerID);
+		FContainerActionRequest Request(EContainerAction::SetECLevel);
+		Request.Value = NewEC;
+		SendPredictedAction(this, Request, InstigatingController);
 	}
 }
 
-void AHydroponicsContainer::Server_SetECLevel_Implementation(float NewEC, const FString& PlayerID)
+void AHydroponicsContainer::ExecuteSetECLevel(float NewEC, const FString& PlayerID, int32 PlayerHandle)
 {
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::SetECLevel, SimulationID, PlayerID);
+		Entry.Value = NewEC;
+		Journal->Record(Entry);
+	}
+	
 	CurrentConditions.ECLevel = FMath::Clamp(NewEC, 0.0f, 4.0f);
-	OnEnvironmentalChange.Broadcast(TEXT("EC"), CurrentConditions.ECLevel);
-	OnContainerInteraction.Broadcast(PlayerID, FString::Printf(TEXT("Adjusted EC to %.2f"), CurrentConditions.ECLevel));
+	CommitCommand();
+	static const FName ECParameter(TEXT("EC"));
+	OnEnvironmentalChange.Broadcast(ECParameter, CurrentConditions.ECLevel);
+	OnContainerInteraction.Broadcast(FContainerEvent(EContainerEventType::ECAdjusted, PlayerHandle, CurrentConditions.ECLevel));
 	
-	UE_LOG(LogTemp, Log, TEXT("Player %s adjusted EC to %.2f"), *PlayerID, CurrentConditions.ECLevel);
-}
-
-bool AHydroponicsContainer::Server_SetECLevel_Validate(float NewEC, const FString& PlayerID)
-{
-	return NewEC >= 0.0f && NewEC <= 4.0f;
+	UE_LOG(LogTemp, Verbose, TEXT("Player %s adjusted EC to %.2f"), *PlayerID, CurrentConditions.ECLevel);
 }
 
 void AHydroponicsContainer::SetWaterLevel(float NewLevel)
 {
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::SetWaterLevel, SimulationID, FString());
+		Entry.Value = NewLevel;
+		Journal->Record(Entry);
+	}
+	
 	CurrentConditions.WaterLevel = FMath::Clamp(NewLevel, 0.0f, 1.0f);
-	OnEnvironmentalChange.Broadcast(TEXT("Water Level"), CurrentConditions.WaterLevel);
+	CommitCommand();
+	static const FName WaterLevelParameter(TEXT("Water Level"));
+	OnEnvironmentalChange.Broadcast(WaterLevelParameter, CurrentConditions.WaterLevel);
 }
 
-void AHydroponicsContainer::AddNutrients(const FNutrientLevels& Nutrients, const FString& PlayerID)
+void AHydroponicsContainer::AddNutrients(const FNutrientLevels& Nutrients, const FString& PlayerID, AHydroGrowPlayerController* InstigatingController)
 {
 	if (!PlayerID.IsEmpty() && !CanPlayerInteract(PlayerID, EContainerPermission::AddNutrients))
 	{
@@ -374,15 +557,33 @@ void AHydroponicsContainer::AddNutrients(const FNutrientLevels& Nutrients, const
 	
 	if (HasAuthority())
 	{
-		Server_AddNutrients(Nutrients, PlayerID);
+		ExecuteAddNutrients(Nutrients, PlayerID, GetPlayerHandle(InstigatingController));
 	}
 	else
 	{
-		Server_AddNutrients(Nutrients, PlayerID);
+		FContainerActionRequest Request(EContainerAction::AddNutrients);
+		Request.Nutrients = Nutrients;
+		SendPredictedAction(this, Request, InstigatingController);
+	}
+}
+
+void AHydroponicsContainer::ExecuteAddNutrients(const FNutrientLevels& Nutrients, const FString& PlayerID, int32 PlayerHandle)
+{
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::AddNutrients, SimulationID, PlayerID);
+		Entry.Nutrients = Nutrients;
+		Journal->Record(Entry);
 	}
+	
+	MixNutrients(Nutrients);
+	CommitCommand();
+	
+	OnContainerInteraction.Broadcast(FContainerEvent(EContainerEventType::NutrientsAdded, PlayerHandle, CurrentConditions.ECLevel));
+	UE_LOG(LogTemp, Verbose, TEXT("Player %s added nutrients, new EC: %.2f"), *PlayerID, CurrentConditions.ECLevel);
 }
 
-void AHydroponicsContainer::Server_AddNutrients_Implementation(const FNutrientLevels& Nutrients, const FString& PlayerID)
+void AHydroponicsContainer::MixNutrients(const FNutrientLevels& Nutrients)
 {
 	// Add nutrients to the solution
 	NutrientSolution.Nitrogen += Nutrients.Nitrogen;
@@ -403,17 +604,9 @@ void AHydroponicsContainer::Server_AddNutrients_Implementation(const FNutrientLe
 	// Update EC based on nutrient concentration
 	float TotalNutrients = (NutrientSolution.Nitrogen + NutrientSolution.Phosphorus + NutrientSolution.Potassium) / 3.0f;
 	CurrentConditions.ECLevel = TotalNutrients * 1.5f;
-	
-	OnContainerInteraction.Broadcast(PlayerID, TEXT("Added nutrients"));
-	UE_LOG(LogTemp, Log, TEXT("Player %s added nutrients, new EC: %.2f"), *PlayerID, CurrentConditions.ECLevel);
 }
 
-bool AHydroponicsContainer::Server_AddNutrients_Validate(const FNutrientLevels& Nutrients, const FString& PlayerID)
-{
-	return true;
-}
-
-void AHydroponicsContainer::StartWaterPump(const FString& PlayerID)
+void AHydroponicsContainer::StartWaterPump(const FString& PlayerID, AHydroGrowPlayerController* InstigatingController)
 {
 	if (!PlayerID.IsEmpty() && !CanPlayerInteract(PlayerID, EContainerPermission::OperateEquipment))
 	{
@@ -423,15 +616,15 @@ void AHydroponicsContainer::StartWaterPump(const FString& PlayerID)
 	
 	if (HasAuthority())
 	{
-		Server_StartWaterPump(PlayerID);
+		ExecuteStartWaterPump(PlayerID, GetPlayerHandle(InstigatingController));
 	}
 	else
 	{
-		Server_StartWaterPump(PlayerID);
+		SendPredictedAction(this, FContainerActionRequest(EContainerAction::StartWaterPump), InstigatingController);
 	}
 }
 
-void AHydroponicsContainer::StopWaterPump(const FString& PlayerID)
+void AHydroponicsContainer::StopWaterPump(const FString& PlayerID, AHydroGrowPlayerController* InstigatingController)
 {
 	if (!PlayerID.IsEmpty() && !CanPlayerInteract(PlayerID, EContainerPermission::OperateEquipment))
 	{
@@ -441,16 +634,22 @@ void AHydroponicsContainer::StopWaterPump(const FString& PlayerID)
 	
 	if (HasAuthority())
 	{
-		Server_StopWaterPump(PlayerID);
+		ExecuteStopWaterPump(PlayerID, GetPlayerHandle(InstigatingController));
 	}
 	else
 	{
-		Server_StopWaterPump(PlayerID);
+		SendPredictedAction(this, FContainerActionRequest(EContainerAction::StopWaterPump), InstigatingController);
 	}
 }
 
-void AHydroponicsContainer::Server_StartWaterPump_Implementation(const FString& PlayerID)
+void AHydroponicsContainer::ExecuteStartWaterPump(const FString& PlayerID, int32 PlayerHandle)
 {
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::StartWaterPump, SimulationID, PlayerID);
+		Journal->Record(Entry);
+	}
+	
 	if (ContainerType == EContainerType::DWC)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("DWC containers don't use water pumps"));
@@ -459,28 +658,26 @@ void AHydroponicsContainer::Server_StartWaterPump_Implementation(const FString&
 	
 	bPumpRunning = true;
 	EnergyConsumptionRate = BaseEnergyConsumption + PumpEnergyConsumption;
+	CommitCommand();
 	
-	OnContainerInteraction.Broadcast(PlayerID, TEXT("Started water pump"));
-	UE_LOG(LogTemp, Log, TEXT("Player %s started water pump"), *PlayerID);
+	OnContainerInteraction.Broadcast(FContainerEvent(EContainerEventType::PumpStarted, PlayerHandle));
+	UE_LOG(LogTemp, Verbose, TEXT("Player %s started water pump"), *PlayerID);
 }
 
-bool AHydroponicsContainer::Server_StartWaterPump_Validate(const FString& PlayerID)
-{
-	return true;
-}
-
-void AHydroponicsContainer::Server_StopWaterPump_Implementation(const FString& PlayerID)
+void AHydroponicsContainer::ExecuteStopWaterPump(const FString& PlayerID, int32 PlayerHandle)
 {
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::StopWaterPump, SimulationID, PlayerID);
+		Journal->Record(Entry);
+	}
+	
 	bPumpRunning = false;
 	EnergyConsumptionRate = BaseEnergyConsumption;
+	CommitCommand();
 	
-	OnContainerInteraction.Broadcast(PlayerID, TEXT("Stopped water pump"));
-	UE_LOG(LogTemp, Log, TEXT("Player %s stopped water pump"), *PlayerID);
-}
-
-bool AHydroponicsContainer::Server_StopWaterPump_Validate(const FString& PlayerID)
-{
-	return true;
+	OnContainerInteraction.Broadcast(FContainerEvent(EContainerEventType::PumpStopped, PlayerHandle));
+	UE_LOG(LogTemp, Verbose, TEXT("Player %s stopped water pump"), *PlayerID);
 }
 
 int32 AHydroponicsContainer::GetPlantCount() const
@@ -514,42 +711,404 @@ TArray<APlantActor*> AHydroponicsContainer::GetAllPlants() const
 	return Plants;
 }
 
-void AHydroponicsContainer::UpdateEnvironmentalConditions(float DeltaTime)
+void AHydroponicsContainer::GatherChemistryState(FContainerChemistryState& OutState) const
+{
+	OutState.PlantCount = GetPlantCount();
+	OutState.bPumpRunning = bPumpRunning;
+	OutState.WaterCapacity = WaterCapacity;
+	OutState.FlowConductance = 0.0f;
+	if (bPumpRunning && SupplyReservoir)
+	{
+		// Flow rate is the fraction of capacity exchanged per game hour, scaled by how well the system circulates
+		const float* EfficiencyMultiplier = TypeEfficiencyMultipliers.Find(ContainerType);
+		OutState.FlowConductance = WaterFlowRate * WaterCapacity * (EfficiencyMultiplier ? *EfficiencyMultiplier : 1.0f);
+	}
+	OutState.RandomStream = static_cast<uint32>(SimulationID);
+	OutState.PHLevel = CurrentConditions.PHLevel;
+	OutState.ECLevel = CurrentConditions.ECLevel;
+	OutState.OxygenLevel = CurrentConditions.OxygenLevel;
+	OutState.WaterLevel = CurrentConditions.WaterLevel;
+	OutState.Nitrogen = NutrientSolution.Nitrogen;
+	OutState.Phosphorus = NutrientSolution.Phosphorus;
+	OutState.Potassium = NutrientSolution.Potassium;
+	OutState.Alerts = EContainerChemistryAlert::None;
+}
+
+void AHydroponicsContainer::ApplyChemistryState(const FContainerChemistryState& State)
+{
+	// Only a real change invalidates the digest; idle containers step without touching it
+	const bool bChanged = CurrentConditions.PHLevel != State.PHLevel || CurrentConditions.ECLevel != State.ECLevel
+		|| CurrentConditions.OxygenLevel != State.OxygenLevel || CurrentConditions.WaterLevel != State.WaterLevel
+		|| NutrientSolution.Nitrogen != State.Nitrogen || NutrientSolution.Phosphorus != State.Phosphorus
+		|| NutrientSolution.Potassium != State.Potassium;
+	if (!bChanged)
+	{
+		return;
+	}
+	
+	CurrentConditions.PHLevel = State.PHLevel;
+	CurrentConditions.ECLevel = State.ECLevel;
+	CurrentConditions.OxygenLevel = State.OxygenLevel;
+	CurrentConditions.WaterLevel = State.WaterLevel;
+	NutrientSolution.Nitrogen = State.Nitrogen;
+	NutrientSolution.Phosphorus = State.Phosphorus;
+	NutrientSolution.Potassium = State.Potassium;
+	bStateDigestDirty = true;
+	
+	UpdatePlantConditions();
+}
+
+void AHydroponicsContainer::SetSupplyReservoir(AHydroponicsContainer* Reservoir)
+{
+	if (!HasAuthority() || Reservoir == this || Reservoir == SupplyReservoir)
+	{
+		return;
+	}
+	
+	if (USimulationJournal* Journal = USimulationJournal::GetIfRecording(this))
+	{
+		FJournalEntry Entry(EJournalCommand::SetSupplyReservoir, SimulationID, FString());
+		Entry.ArgumentID = Reservoir ? Reservoir->GetSimulationID() : 0;
+		Journal->Record(Entry);
+	}
+	
+	SupplyReservoir = Reservoir;
+	
+	if (UContainerSimulationSubsystem* Simulation = GetWorld()->GetSubsystem<UContainerSimulationSubsystem>())
+	{
+		Simulation->MarkPlumbingDirty();
+	}
+}
+
+uint32 AHydroponicsContainer::GetSimulationStateHash() const
+{
+	const float Values[] =
+	{
+		CurrentConditions.PHLevel, CurrentConditions.ECLevel, CurrentConditions.OxygenLevel, CurrentConditions.WaterLevel,
+		NutrientSolution.Nitrogen, NutrientSolution.Phosphorus, NutrientSolution.Potassium
+	};
+	const int32 Flags[] = { bPumpRunning ? 1 : 0, GetPlantCount() };
+	
+	uint32 Hash = FCrc::MemCrc32(&SimulationID, sizeof(SimulationID));
+	Hash = FCrc::MemCrc32(Values, sizeof(Values), Hash);
+	return FCrc::MemCrc32(Flags, sizeof(Flags), Hash);
+}
+
+void AHydroponicsContainer::BuildStateDigest(FStateDigest& OutDigest) const
+{
+	int32 OccupiedSlots = 0;
+	for (const FPlantSlot& Slot : PlantSlots)
+	{
+		OccupiedSlots += Slot.bIsOccupied ? 1 : 0;
+	}
+	
+	// Order must match GetDigestFieldName
+	OutDigest.Reset();
+	OutDigest.AddField(CurrentConditions.PHLevel);
+	OutDigest.AddField(CurrentConditions.ECLevel);
+	OutDigest.AddField(CurrentConditions.OxygenLevel);
+	OutDigest.AddField(CurrentConditions.WaterLevel);
+	OutDigest.AddField(NutrientSolution.Nitrogen);
+	OutDigest.AddField(NutrientSolution.Phosphorus);
+	OutDigest.AddField(NutrientSolution.Potassium);
+	OutDigest.AddField((bPumpRunning ? 1 : 0) | (OccupiedSlots << 1));
+	
+	// Plants as clients receive them: the quantized anchor, not the server's live or the client's extrapolated values
+	uint32 PlantStages = 0;
+	uint32 PlantProgress = 0;
+	uint32 PlantHealth = 0;
+	for (const FPlantSlot& Slot : PlantSlots)
+	{
+		if (Slot.bIsOccupied && Slot.PlantActor)
+		{
+			const FPlantReplicatedState& PlantState = Slot.PlantActor->GetReplicatedState();
+			PlantStages = FCrc::MemCrc32(&PlantState.Stage, sizeof(PlantState.Stage), PlantStages);
+			PlantProgress = FCrc::MemCrc32(&PlantState.Progress, sizeof(PlantState.Progress), PlantProgress);
+			PlantHealth = FCrc::MemCrc32(&PlantState.Health, sizeof(PlantState.Health), PlantHealth);
+		}
+	}
+	OutDigest.AddField(static_cast<int32>(PlantStages));
+	OutDigest.AddField(static_cast<int32>(PlantProgress));
+	OutDigest.AddField(static_cast<int32>(PlantHealth));
+}
+
+const TCHAR* AHydroponicsContainer::GetDigestFieldName(int32 Field)
 {
-	SimulatePHDrift(DeltaTime);
-	SimulateNutrientDepletion(DeltaTime);
-	SimulateWaterEvaporation(DeltaTime);
+	// Order must match BuildStateDigest
+	static const TCHAR* DigestFieldNames[] = { TEXT("PHLevel"), TEXT("ECLevel"), TEXT("OxygenLevel"), TEXT("WaterLevel"),
+		TEXT("Nitrogen"), TEXT("Phosphorus"), TEXT("Potassium"), TEXT("PumpAndSlots"),
+		TEXT("PlantStages"), TEXT("PlantProgress"), TEXT("PlantHealth") };
+	
+	return Field >= 0 && Field < UE_ARRAY_COUNT(DigestFieldNames) ? DigestFieldNames[Field] : TEXT("Unknown");
 }
 
-void AHydroponicsContainer::UpdateWaterSystem(float DeltaTime)
+void AHydroponicsContainer::OnRep_StateDigest()
 {
-	if (bPumpRunning)
+	CheckForDivergence();
+}
+
+void AHydroponicsContainer::CheckForDivergence()
+{
+	// Predicted actions legitimately differ from the server until they are resolved
+	if (HasAuthority() || !StateDigest.IsSet() || PendingPredictions.Num() > 0)
+	{
+		return;
+	}
+	
+	FStateDigest LocalDigest;
+	BuildStateDigest(LocalDigest);
+	
+	if (LocalDigest == StateDigest)
+	{
+		bDiverged = false;
+		MismatchStartTime = -1.0;
+		return;
+	}
+	
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (MismatchStartTime < 0.0)
+	{
+		MismatchStartTime = Now;
+	}
+	
+	// Report once per divergence rather than on every check
+	if (!bDiverged && Now - MismatchStartTime >= DivergenceConfirmSeconds)
 	{
-		// Pump maintains water circulation and oxygenation
-		CurrentConditions.OxygenLevel = FMath::Min(CurrentConditions.OxygenLevel + 0.1f * DeltaTime, 1.5f);
+		const int32 Field = StateDigest.FindFirstMismatch(LocalDigest);
 		
-		// Better nutrient distribution with pump running
-		UpdateNutrientDistribution();
+		bDiverged = true;
+		DivergenceCount++;
+		UE_LOG(LogTemp, Warning, TEXT("Container %s diverged from server: first mismatching field %s"),
+			*GetName(), GetDigestFieldName(Field));
+		
+		// Any local controller will do; the report is per connection, not per player
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			AHydroGrowPlayerController* PlayerController = Cast<AHydroGrowPlayerController>(It->Get());
+			if (PlayerController && PlayerController->IsLocalController())
+			{
+				PlayerController->Server_ReportDivergence(this, Field);
+				break;
+			}
+		}
 	}
-	else
+}
+
+void AHydroponicsContainer::HandleDivergenceReport(const APlayerState* Reporter, int32 FirstMismatchField)
+{
+	DivergenceCount++;
+	UE_LOG(LogTemp, Warning, TEXT("Container %s: %s reports divergence (first mismatching field %s, %d reports)"),
+		*GetName(), Reporter ? *Reporter->GetPlayerName() : TEXT("unknown player"), GetDigestFieldName(FirstMismatchField), DivergenceCount);
+}
+
+void AHydroponicsContainer::CommitCommand()
+{
+	StateRevision++;
+	bStateDigestDirty = true;
+}
+
+bool AHydroponicsContainer::ExecuteAction(const FContainerActionRequest& Request, const FString& PlayerID, int32 PlayerHandle)
+{
+	if (!HasAuthority() || !CanPlayerInteract(PlayerID, GetActionPermission(Request.Action)))
+	{
+		return false;
+	}
+	
+	const int32 PreviousRevision = StateRevision;
+	switch (Request.Action)
+	{
+	case EContainerAction::PlantSeed:
+		ExecutePlantSeed(Request.PlantSpeciesID, Request.SlotIndex, PlayerID, PlayerHandle);
+		break;
+	case EContainerAction::RemovePlant:
+		ExecuteRemovePlant(Request.SlotIndex, PlayerID, PlayerHandle);
+		break;
+	case EContainerAction::SetPHLevel:
+		ExecuteSetPHLevel(Request.Value, PlayerID, PlayerHandle);
+		break;
+	case EContainerAction::SetECLevel:
+		ExecuteSetECLevel(Request.Value, PlayerID, PlayerHandle);
+		break;
+	case EContainerAction::AddNutrients:
+		ExecuteAddNutrients(Request.Nutrients, PlayerID, PlayerHandle);
+		break;
+	case EContainerAction::StartWaterPump:
+		ExecuteStartWaterPump(PlayerID, PlayerHandle);
+		break;
+	case EContainerAction::StopWaterPump:
+		ExecuteStopWaterPump(PlayerID, PlayerHandle);
+		break;
+	}
+	
+	// Refused commands (occupied slot, pump on a DWC) leave the revision unchanged
+	return StateRevision != PreviousRevision;
+}
+
+void AHydroponicsContainer::AcknowledgePredictions(int32 PlayerId, int32 PredictionKey)
+{
+	FPredictionAck* Ack = PredictionAcks.FindByPredicate([PlayerId](const FPredictionAck& Entry)
+	{
+		return Entry.PlayerId == PlayerId;
+	});
+	
+	if (!Ack)
+	{
+		// New player: forget the players who have left
+		if (const AGameStateBase* GameState = GetWorld()->GetGameState())
+		{
+			PredictionAcks.RemoveAll([GameState](const FPredictionAck& Entry)
+			{
+				return !GameState->PlayerArray.ContainsByPredicate([&Entry](const APlayerState* PlayerState)
+				{
+					return PlayerState && PlayerState->GetPlayerId() == Entry.PlayerId;
+				});
+			});
+		}
+		
+		Ack = &PredictionAcks.AddDefaulted_GetRef();
+		Ack->PlayerId = PlayerId;
+	}
+	
+	Ack->PredictionKey = FMath::Max(Ack->PredictionKey, PredictionKey);
+}
+
+int32 AHydroponicsContainer::GetAcknowledgedPredictionKey(int32 PlayerId) const
+{
+	const FPredictionAck* Ack = PredictionAcks.FindByPredicate([PlayerId](const FPredictionAck& Entry)
+	{
+		return Entry.PlayerId == PlayerId;
+	});
+	
+	return Ack ? Ack->PredictionKey : 0;
+}
+
+void AHydroponicsContainer::PredictAction(const FContainerActionRequest& Request, int32 PlayerId)
+{
+	if (HasAuthority())
 	{
-		// Oxygen levels drop without circulation
-		CurrentConditions.OxygenLevel = FMath::Max(CurrentConditions.OxygenLevel - 0.05f * DeltaTime, 0.3f);
+		return;
+	}
+	
+	FPendingPrediction& Prediction = PendingPredictions.AddDefaulted_GetRef();
+	Prediction.Request = Request;
+	Prediction.PlayerId = PlayerId;
+	ApplyPredictedAction(Request);
+}
+
+void AHydroponicsContainer::RejectPrediction(int32 PlayerId, int32 PredictionKey)
+{
+	const int32 Index = PendingPredictions.IndexOfByPredicate([PlayerId, PredictionKey](const FPendingPrediction& Prediction)
+	{
+		return Prediction.PlayerId == PlayerId && Prediction.Request.PredictionKey == PredictionKey;
+	});
+	
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("Server rejected %s on %s, rolling back"),
+		*UEnum::GetValueAsString(PendingPredictions[Index].Request.Action), *GetName());
+	PendingPredictions.RemoveAt(Index);
+	
+	ReconcilePredictions();
+}
+
+void AHydroponicsContainer::ApplyPredictedAction(const FContainerActionRequest& Request)
+{
+	// Mirrors the server commands, minus spawning and destroying plants
+	switch (Request.Action)
+	{
+	case EContainerAction::PlantSeed:
+		if (CanPlantSeed(Request.SlotIndex))
+		{
+			// Occupied without an actor until the spawned plant replicates
+			PlantSlots[Request.SlotIndex].bIsOccupied = true;
+		}
+		break;
+	case EContainerAction::RemovePlant:
+		if (PlantSlots.IsValidIndex(Request.SlotIndex) && PlantSlots[Request.SlotIndex].bIsOccupied)
+		{
+			if (PlantSlots[Request.SlotIndex].PlantActor)
+			{
+				PlantSlots[Request.SlotIndex].PlantActor->SetActorHiddenInGame(true);
+			}
+			PlantSlots[Request.SlotIndex].bIsOccupied = false;
+			PlantSlots[Request.SlotIndex].PlantActor = nullptr;
+		}
+		break;
+	case EContainerAction::SetPHLevel:
+		CurrentConditions.PHLevel = FMath::Clamp(Request.Value, 4.0f, 8.0f);
+		break;
+	case EContainerAction::SetECLevel:
+		CurrentConditions.ECLevel = FMath::Clamp(Request.Value, 0.0f, 4.0f);
+		break;
+	case EContainerAction::AddNutrients:
+		MixNutrients(Request.Nutrients);
+		break;
+	case EContainerAction::StartWaterPump:
+		bPumpRunning = ContainerType != EContainerType::DWC;
+		break;
+	case EContainerAction::StopWaterPump:
+		bPumpRunning = false;
+		break;
 	}
 }
 
-void AHydroponicsContainer::UpdateNutrientDistribution()
+void AHydroponicsContainer::ReconcilePredictions()
 {
-	// Even distribution of nutrients when pump is running
-	// This affects how plants receive nutrients
+	// Drop predictions the replicated state already includes
+	PendingPredictions.RemoveAll([this](const FPendingPrediction& Prediction)
+	{
+		return Prediction.Request.PredictionKey <= GetAcknowledgedPredictionKey(Prediction.PlayerId);
+	});
 	
-	// Apply container type efficiency
-	const float* EfficiencyMultiplier = TypeEfficiencyMultipliers.Find(ContainerType);
-	if (EfficiencyMultiplier)
+	// Undo predicted removals, then rebuild from the server's state plus whatever is still in flight
+	for (const FPlantSlot& Slot : AuthoritativeSlots)
 	{
-		// Apply efficiency to nutrient availability
-		// This would be used in plant calculations
+		if (Slot.PlantActor)
+		{
+			Slot.PlantActor->SetActorHiddenInGame(false);
+		}
 	}
+	
+	PlantSlots = AuthoritativeSlots;
+	CurrentConditions = AuthoritativeConditions;
+	NutrientSolution = AuthoritativeNutrients;
+	bPumpRunning = bAuthoritativePumpRunning;
+	
+	for (const FPendingPrediction& Prediction : PendingPredictions)
+	{
+		ApplyPredictedAction(Prediction.Request);
+	}
+}
+
+// The notifies only record the server's values; PostRepNotifies reconciles once every property of the update is in
+void AHydroponicsContainer::OnRep_PlantSlots()
+{
+	AuthoritativeSlots = PlantSlots;
+}
+
+void AHydroponicsContainer::OnRep_CurrentConditions()
+{
+	AuthoritativeConditions = CurrentConditions;
+}
+
+void AHydroponicsContainer::OnRep_NutrientSolution()
+{
+	AuthoritativeNutrients = NutrientSolution;
+}
+
+void AHydroponicsContainer::OnRep_PumpRunning()
+{
+	bAuthoritativePumpRunning = bPumpRunning;
+}
+
+void AHydroponicsContainer::PostRepNotifies()
+{
+	Super::PostRepNotifies();
+	
+	ReconcilePredictions();
 }
 
 void AHydroponicsContainer::UpdatePlantConditions()
@@ -560,7 +1119,7 @@ void AHydroponicsContainer::UpdatePlantConditions()
 		if (Slot.bIsOccupied && Slot.PlantActor)
 		{
 			Slot.PlantActor->SetEnvironmentalConditions(CurrentConditions);
-			Slot.PlantActor->ApplyNutrients(NutrientSolution);
+			Slot.PlantActor->SetNutrientLevels(NutrientSolution);
 		}
 	}
 }
@@ -603,51 +1162,6 @@ void AHydroponicsContainer::UpdateVisualEffects()
 	// Visual indicators for system status could be added here
 }
 
-void AHydroponicsContainer::SimulatePHDrift(float DeltaTime)
-{
-	// pH naturally drifts over time based on plant uptake and system type
-	float DriftRate = 0.1f; // pH units per day
-	float DriftDirection = FMath::RandRange(-1.0f, 1.0f);
-	
-	// Plants affect pH through nutrient uptake
-	float PlantEffect = GetPlantCount() * 0.02f * DeltaTime;
-	
-	CurrentConditions.PHLevel += (DriftDirection * DriftRate + PlantEffect) * DeltaTime / 86400.0f;
-	CurrentConditions.PHLevel = FMath::Clamp(CurrentConditions.PHLevel, 4.0f, 8.0f);
-}
-
-void AHydroponicsContainer::SimulateNutrientDepletion(float DeltaTime)
-{
-	// Plants consume nutrients over time
-	float ConsumptionRate = GetPlantCount() * 0.01f * DeltaTime;
-	
-	NutrientSolution.Nitrogen = FMath::Max(NutrientSolution.Nitrogen - ConsumptionRate, 0.0f);
-	NutrientSolution.Phosphorus = FMath::Max(NutrientSolution.Phosphorus - ConsumptionRate * 0.8f, 0.0f);
-	NutrientSolution.Potassium = FMath::Max(NutrientSolution.Potassium - ConsumptionRate * 1.2f, 0.0f);
-	
-	// Update EC based on remaining nutrients
-	float TotalNutrients = (NutrientSolution.Nitrogen + NutrientSolution.Phosphorus + NutrientSolution.Potassium) / 3.0f;
-	CurrentConditions.ECLevel = TotalNutrients * 1.5f;
-}
-
-void AHydroponicsContainer::SimulateWaterEvaporation(float DeltaTime)
-{
-	// Water evaporates slowly over time
-	float EvaporationRate = 0.05f * DeltaTime / 86400.0f; // 5% per day
-	
-	CurrentConditions.WaterLevel = FMath::Max(CurrentConditions.WaterLevel - EvaporationRate, 0.0f);
-	
-	// Low water levels affect other conditions
-	if (CurrentConditions.WaterLevel < 0.3f)
-	{
-		// Concentrated nutrients
-		CurrentConditions.ECLevel *= 1.1f;
-		
-		// Reduced oxygen
-		CurrentConditions.OxygenLevel *= 0.9f;
-	}
-}
-
 // Network permission functions
 bool AHydroponicsContainer::CanPlayerInteract(const FString& PlayerID, EContainerPermission Permission) const
 {
@@ -697,6 +1211,24 @@ class AHydroGrowNetworkGameMode* AHydroponicsContainer::GetNetworkGameMode() con
 	return nullptr;
 }
 
+EContainerPermission AHydroponicsContainer::GetActionPermission(EContainerAction Action)
+{
+	switch (Action)
+	{
+	case EContainerAction::PlantSeed:
+		return EContainerPermission::PlantSeeds;
+	case EContainerAction::RemovePlant:
+		return EContainerPermission::HarvestPlants;
+	case EContainerAction::AddNutrients:
+		return EContainerPermission::AddNutrients;
+	case EContainerAction::StartWaterPump:
+	case EContainerAction::StopWaterPump:
+		return EContainerPermission::OperateEquipment;
+	default:
+		return EContainerPermission::AdjustEnvironment;
+	}
+}
+
 bool AHydroponicsContainer::HasPermission(const FString& PlayerID, EContainerPermission Permission) const
 {
 	if (AHydroGrowNetworkGameMode* GameMode = GetNetworkGameMode())
@@ -0,0 +1,301 @@
+#include "Systems/SignificanceSubsystem.h"
+#include "Plants/PlantActor.h"
+#include "Systems/HydroponicsContainer.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorldAndArgs SignificanceStatsCommand(
+	TEXT("HydroGrow.Significance.Stats"),
+	TEXT("Print plants and containers per significance tier and last frame's visual update counts"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (const USignificanceSubsystem* Significance = USignificanceSubsystem::Get(World))
+		{
+			Significance->LogStats();
+		}
+	}));
+
+USignificanceSubsystem::USignificanceSubsystem()
+{
+	ClassifyInterval = 0.25f;
+	OnScreenTolerance = 0.2f;
+	TimeSinceClassify = TNumericLimits<float>::Max();
+	VisualCursor = 0;
+	bSimulationDeferralEnabled = true;
+
+	TierSettings.SetNum(3);
+
+	FSignificanceTierSettings& Near = TierSettings[static_cast<int32>(ESignificanceTier::Near)];
+	Near.MaxDistance = 1500.0f;
+	Near.VisualInterval = 0.0f;
+	Near.MaxVisualUpdatesPerFrame = 64;
+
+	FSignificanceTierSettings& Visible = TierSettings[static_cast<int32>(ESignificanceTier::Visible)];
+	Visible.MaxDistance = 5000.0f;
+	Visible.VisualInterval = 0.25f;
+	Visible.MaxVisualUpdatesPerFrame = 16;
+
+	FSignificanceTierSettings& Distant = TierSettings[static_cast<int32>(ESignificanceTier::Distant)];
+	Distant.VisualInterval = -1.0f;
+	Distant.MaxDeferredGameSeconds = 600.0f; // Ten game minutes
+
+	Stats.SetNum(3);
+}
+
+USignificanceSubsystem* USignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<USignificanceSubsystem>() : nullptr;
+}
+
+bool USignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void USignificanceSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	ViewLocations.Empty();
+
+	Super::Deinitialize();
+}
+
+const FSignificanceTierSettings& USignificanceSubsystem::GetSettings(ESignificanceTier Tier) const
+{
+	static const FSignificanceTierSettings FullDetail;
+	const int32 Index = static_cast<int32>(Tier);
+	return TierSettings.IsValidIndex(Index) ? TierSettings[Index] : FullDetail;
+}
+
+void USignificanceSubsystem::RegisterPlant(APlantActor* Plant)
+{
+	if (Plant)
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Actor = Plant;
+		Entry.bIsPlant = true;
+
+		// Classify on the next tick, before any visual update is skipped
+		TimeSinceClassify = TNumericLimits<float>::Max();
+	}
+}
+
+void USignificanceSubsystem::RegisterContainer(AHydroponicsContainer* Container)
+{
+	if (Container)
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Actor = Container;
+		Entry.bIsPlant = false;
+		TimeSinceClassify = TNumericLimits<float>::Max();
+	}
+}
+
+void USignificanceSubsystem::Unregister(AActor* Actor)
+{
+	Entries.RemoveAllSwap([Actor](const FEntry& Entry) { return Entry.Actor == Actor; }, EAllowShrinking::No);
+}
+
+void USignificanceSubsystem::SetSimulationDeferralEnabled(bool bEnabled)
+{
+	if (bSimulationDeferralEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bSimulationDeferralEnabled = bEnabled;
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Actor.IsValid())
+		{
+			// Disabling catches every deferred plant up immediately
+			ApplyTier(Entry, Entry.Tier);
+		}
+	}
+}
+
+void USignificanceSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceClassify += DeltaTime;
+	if (TimeSinceClassify >= ClassifyInterval)
+	{
+		TimeSinceClassify = 0.0f;
+		Classify();
+	}
+
+	UpdateVisuals(GetWorld()->GetTimeSeconds());
+}
+
+void USignificanceSubsystem::Classify()
+{
+	// Locally controlled players are measured from the camera, remote ones from their pawn
+	ViewLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		if (PlayerController->IsLocalController() && PlayerController->PlayerCameraManager)
+		{
+			ViewLocations.Add(PlayerController->PlayerCameraManager->GetCameraLocation());
+		}
+		else if (const APawn* Pawn = PlayerController->GetPawn())
+		{
+			ViewLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	for (FSignificanceTierStats& TierStats : Stats)
+	{
+		TierStats.Entities = 0;
+	}
+
+	for (int32 i = Entries.Num() - 1; i >= 0; i--)
+	{
+		FEntry& Entry = Entries[i];
+		const AActor* Actor = Entry.Actor.Get();
+		if (!Actor)
+		{
+			Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const ESignificanceTier Tier = ClassifyActor(Actor);
+		if (Tier != Entry.Tier || !Entry.bClassified)
+		{
+			Entry.bClassified = true;
+			ApplyTier(Entry, Tier);
+		}
+		Stats[static_cast<int32>(Tier)].Entities++;
+	}
+}
+
+ESignificanceTier USignificanceSubsystem::ClassifyActor(const AActor* Actor) const
+{
+	const FVector Location = Actor->GetActorLocation();
+	float MinDistanceSquared = TNumericLimits<float>::Max();
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(Location, ViewLocation)));
+	}
+
+	if (MinDistanceSquared <= FMath::Square(GetSettings(ESignificanceTier::Near).MaxDistance))
+	{
+		return ESignificanceTier::Near;
+	}
+
+	if (MinDistanceSquared <= FMath::Square(GetSettings(ESignificanceTier::Visible).MaxDistance) || Actor->WasRecentlyRendered(OnScreenTolerance))
+	{
+		return ESignificanceTier::Visible;
+	}
+
+	return ESignificanceTier::Distant;
+}
+
+void USignificanceSubsystem::ApplyTier(FEntry& Entry, ESignificanceTier Tier) const
+{
+	Entry.Tier = Tier;
+
+	if (Entry.bIsPlant)
+	{
+		const float MaxDeferredSeconds = bSimulationDeferralEnabled ? GetSettings(Tier).MaxDeferredGameSeconds : 0.0f;
+		static_cast<APlantActor*>(Entry.Actor.Get())->SetSignificance(Tier, MaxDeferredSeconds);
+	}
+	else
+	{
+		static_cast<AHydroponicsContainer*>(Entry.Actor.Get())->SetSignificanceTier(Tier);
+	}
+}
+
+void USignificanceSubsystem::UpdateVisuals(double Now)
+{
+	for (FSignificanceTierStats& TierStats : Stats)
+	{
+		TierStats.VisualUpdates = 0;
+		TierStats.VisualUpdatesDeferred = 0;
+	}
+
+	const int32 NumEntries = Entries.Num();
+	int32 FirstDeferred = INDEX_NONE;
+
+	for (int32 i = 0; i < NumEntries; i++)
+	{
+		const int32 Index = (VisualCursor + i) % NumEntries;
+		FEntry& Entry = Entries[Index];
+		AActor* Actor = Entry.Actor.Get();
+		const FSignificanceTierSettings& Settings = GetSettings(Entry.Tier);
+
+		if (!Actor || Settings.VisualInterval < 0.0f || Now - Entry.LastVisualUpdateTime < Settings.VisualInterval)
+		{
+			continue;
+		}
+
+		// Plants only change visually when their state does
+		APlantActor* Plant = Entry.bIsPlant ? static_cast<APlantActor*>(Actor) : nullptr;
+		if (Plant && !Plant->HasPendingVisualUpdate())
+		{
+			continue;
+		}
+
+		FSignificanceTierStats& TierStats = Stats[static_cast<int32>(Entry.Tier)];
+		if (TierStats.VisualUpdates >= Settings.MaxVisualUpdatesPerFrame)
+		{
+			TierStats.VisualUpdatesDeferred++;
+			if (FirstDeferred == INDEX_NONE)
+			{
+				FirstDeferred = Index;
+			}
+			continue;
+		}
+
+		if (Plant)
+		{
+			Plant->ApplyPendingVisualUpdate();
+		}
+		else
+		{
+			static_cast<AHydroponicsContainer*>(Actor)->UpdateVisualEffects();
+		}
+
+		Entry.LastVisualUpdateTime = Now;
+		TierStats.VisualUpdates++;
+	}
+
+	// Whoever missed out this frame goes first next frame
+	if (FirstDeferred != INDEX_NONE)
+	{
+		VisualCursor = FirstDeferred;
+	}
+}
+
+FSignificanceTierStats USignificanceSubsystem::GetTierStats(ESignificanceTier Tier) const
+{
+	const int32 Index = static_cast<int32>(Tier);
+	return Stats.IsValidIndex(Index) ? Stats[Index] : FSignificanceTierStats();
+}
+
+void USignificanceSubsystem::LogStats() const
+{
+	UE_LOG(LogTemp, Display, TEXT("Significance: %d entities, %d viewers, simulation deferral %s"),
+		Entries.Num(), ViewLocations.Num(), bSimulationDeferralEnabled ? TEXT("on") : TEXT("off"));
+
+	for (int32 i = 0; i < Stats.Num(); i++)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  %s: %d entities, %d visual updates, %d over budget"),
+			*UEnum::GetDisplayValueAsText(static_cast<ESignificanceTier>(i)).ToString(),
+			Stats[i].Entities, Stats[i].VisualUpdates, Stats[i].VisualUpdatesDeferred);
+	}
+}
@@ -0,0 +1,379 @@
+#include "Systems/SimulationJournal.h"
+#include "Systems/HydroponicsContainer.h"
+#include "Plants/PlantActor.h"
+#include "Systems/SignificanceSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorldAndArgs JournalRecordCommand(
+	TEXT("HydroGrow.Journal.Record"),
+	TEXT("Start recording authoritative commands and simulation steps"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USimulationJournal* Journal = USimulationJournal::Get(World))
+		{
+			Journal->StartRecording();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs JournalStopCommand(
+	TEXT("HydroGrow.Journal.Stop"),
+	TEXT("Stop recording and save the journal. Usage: HydroGrow.Journal.Stop [SlotName]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USimulationJournal* Journal = USimulationJournal::Get(World))
+		{
+			Journal->StopRecording(Args.Num() > 0 ? Args[0] : TEXT("Journal"));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs JournalReplayCommand(
+	TEXT("HydroGrow.Journal.Replay"),
+	TEXT("Replay a saved journal on the current map and compare state hashes. Usage: HydroGrow.Journal.Replay [SlotName]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USimulationJournal* Journal = USimulationJournal::Get(World))
+		{
+			Journal->Replay(Args.Num() > 0 ? Args[0] : TEXT("Journal"));
+		}
+	}));
+
+USimulationJournal::USimulationJournal()
+{
+	HashIntervalSteps = 1;
+	Recording = nullptr;
+	TimeManager = nullptr;
+	NextSimulationID = 1;
+}
+
+USimulationJournal* USimulationJournal::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<USimulationJournal>() : nullptr;
+}
+
+USimulationJournal* USimulationJournal::GetIfRecording(const UObject* WorldContextObject)
+{
+	USimulationJournal* Journal = Get(WorldContextObject);
+	return Journal && Journal->IsRecording() ? Journal : nullptr;
+}
+
+bool USimulationJournal::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USimulationJournal::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Only the server's commands are authoritative
+	if (InWorld.GetNetMode() == NM_Client || !InWorld.GetGameInstance())
+	{
+		return;
+	}
+
+	TimeManager = InWorld.GetGameInstance()->GetSubsystem<UTimeManager>();
+	if (TimeManager)
+	{
+		StepCompleteHandle = TimeManager->OnSimulationStepComplete.AddUObject(this, &USimulationJournal::OnSimulationStepComplete);
+		TimeManager->OnTimeModeChanged.AddDynamic(this, &USimulationJournal::HandleTimeModeChanged);
+	}
+}
+
+void USimulationJournal::Deinitialize()
+{
+	if (TimeManager)
+	{
+		TimeManager->OnSimulationStepComplete.Remove(StepCompleteHandle);
+		TimeManager->OnTimeModeChanged.RemoveDynamic(this, &USimulationJournal::HandleTimeModeChanged);
+		TimeManager = nullptr;
+	}
+
+	Recording = nullptr;
+
+	Super::Deinitialize();
+}
+
+void USimulationJournal::StartRecording()
+{
+	if (Recording || !TimeManager)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Journal: cannot start recording (%s)"), Recording ? TEXT("already recording") : TEXT("no time manager"));
+		return;
+	}
+
+	// Deferral depends on where players stand, so a replay could not reproduce it
+	if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
+	{
+		Significance->SetSimulationDeferralEnabled(false);
+	}
+
+	Recording = NewObject<USimulationJournalRecording>(this);
+	Recording->MapName = GetWorld()->GetMapName();
+	Recording->StartGameTicks = TimeManager->GetGameTicks();
+	Recording->StartStepIndex = TimeManager->GetSimulationStepIndex();
+	Recording->StartNextSimulationID = NextSimulationID;
+	Recording->StartStateHash = ComputeWorldStateHash();
+
+	UE_LOG(LogTemp, Log, TEXT("Journal: recording on %s from step %lld"), *Recording->MapName, Recording->StartStepIndex);
+}
+
+bool USimulationJournal::StopRecording(const FString& SlotName)
+{
+	if (!Recording)
+	{
+		return false;
+	}
+
+	const bool bSaved = UGameplayStatics::SaveGameToSlot(Recording, SlotName, 0);
+	UE_LOG(LogTemp, Log, TEXT("Journal: %s %d commands over %d steps to slot %s"),
+		bSaved ? TEXT("saved") : TEXT("FAILED to save"), Recording->Entries.Num(), Recording->Steps.Num(), *SlotName);
+
+	Recording = nullptr;
+
+	if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
+	{
+		Significance->SetSimulationDeferralEnabled(true);
+	}
+	return bSaved;
+}
+
+void USimulationJournal::Record(const FJournalEntry& Entry)
+{
+	if (!Recording)
+	{
+		return;
+	}
+
+	// Commands land between steps, so they apply before the next step to run
+	FJournalEntry& Recorded = Recording->Entries.Add_GetRef(Entry);
+	Recorded.StepIndex = TimeManager ? TimeManager->GetSimulationStepIndex() : 0;
+}
+
+void USimulationJournal::OnSimulationStepComplete(const FSimulationStepContext& Step)
+{
+	if (!Recording)
+	{
+		return;
+	}
+
+	FJournalStep& Recorded = Recording->Steps.AddDefaulted_GetRef();
+	Recorded.StepIndex = Step.StepIndex;
+	Recorded.DeltaGameSeconds = Step.DeltaGameSeconds;
+	Recorded.Tier = Step.Tier;
+
+	if (HashIntervalSteps > 0 && Recording->Steps.Num() % HashIntervalSteps == 0)
+	{
+		Recorded.StateHash = ComputeWorldStateHash();
+	}
+}
+
+void USimulationJournal::HandleTimeModeChanged(EGameTimeMode NewMode)
+{
+	FJournalEntry Entry(EJournalCommand::SetTimeMode, 0, FString());
+	Entry.Argument = FName(*UEnum::GetValueAsString(NewMode));
+	Record(Entry);
+}
+
+uint32 USimulationJournal::ComputeWorldStateHash() const
+{
+	// Summing per-actor hashes keeps the result independent of actor iteration order
+	uint32 Hash = 0;
+
+	for (TActorIterator<AHydroponicsContainer> It(GetWorld()); It; ++It)
+	{
+		Hash += It->GetSimulationStateHash();
+	}
+
+	for (TActorIterator<APlantActor> It(GetWorld()); It; ++It)
+	{
+		if (!It->IsActorBeingDestroyed())
+		{
+			Hash += It->GetSimulationStateHash();
+		}
+	}
+
+	return Hash;
+}
+
+int32 USimulationJournal::RegisterSimulationActor(AActor* Actor, int32 SimulationID)
+{
+	const TWeakObjectPtr<AActor>* Existing = SimulationActors.Find(SimulationID);
+	if (SimulationID <= 0 || (Existing && Existing->IsValid() && Existing->Get() != Actor))
+	{
+		if (SimulationID > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Journal: simulation ID %d of %s is already in use; reassigning"), SimulationID, *GetNameSafe(Actor));
+		}
+
+		while (SimulationActors.Contains(NextSimulationID))
+		{
+			NextSimulationID++;
+		}
+		SimulationID = NextSimulationID++;
+	}
+
+	SimulationActors.Add(SimulationID, Actor);
+	return SimulationID;
+}
+
+AActor* USimulationJournal::FindSimulationActor(int32 SimulationID) const
+{
+	const TWeakObjectPtr<AActor>* Actor = SimulationActors.Find(SimulationID);
+	return Actor ? Actor->Get() : nullptr;
+}
+
+void USimulationJournal::UnregisterSimulationActor(const AActor* Actor, int32 SimulationID)
+{
+	const TWeakObjectPtr<AActor>* Existing = SimulationActors.Find(SimulationID);
+	if (Existing && (!Existing->IsValid() || Existing->Get() == Actor))
+	{
+		SimulationActors.Remove(SimulationID);
+	}
+}
+
+int32 USimulationJournal::Replay(const FString& SlotName)
+{
+	if (Recording || !TimeManager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Journal: cannot replay while recording or without a time manager"));
+		return -1;
+	}
+
+	USimulationJournalRecording* Journal = Cast<USimulationJournalRecording>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+	if (!Journal)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Journal: no journal in slot %s"), *SlotName);
+		return -1;
+	}
+
+	if (Journal->MapName != GetWorld()->GetMapName())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Journal: recorded on %s but replaying on %s"), *Journal->MapName, *GetWorld()->GetMapName());
+	}
+
+	// The replay drives every step itself; stop frame-driven stepping
+	TimeManager->PauseTime();
+
+	USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this);
+	if (Significance)
+	{
+		Significance->SetSimulationDeferralEnabled(false);
+	}
+	TimeManager->SetGameTicks(Journal->StartGameTicks);
+	TimeManager->SetSimulationStepIndex(Journal->StartStepIndex);
+	NextSimulationID = Journal->StartNextSimulationID;
+
+	if (ComputeWorldStateHash() != Journal->StartStateHash)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Journal: world does not match the recording's starting state; expect divergence"));
+	}
+
+	int32 NextEntry = 0;
+	int32 Mismatches = 0;
+	double HashSeconds = 0.0;
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	for (const FJournalStep& Step : Journal->Steps)
+	{
+		while (NextEntry < Journal->Entries.Num() && Journal->Entries[NextEntry].StepIndex <= Step.StepIndex)
+		{
+			ApplyEntry(Journal->Entries[NextEntry++]);
+		}
+
+		TimeManager->SetSimulationStepIndex(Step.StepIndex);
+		TimeManager->StepSimulation(Step.DeltaGameSeconds, Step.Tier);
+
+		if (Step.StateHash != 0)
+		{
+			const double HashStart = FPlatformTime::Seconds();
+			const uint32 Hash = ComputeWorldStateHash();
+			HashSeconds += FPlatformTime::Seconds() - HashStart;
+
+			if (Hash != Step.StateHash)
+			{
+				if (Mismatches == 0)
+				{
+					UE_LOG(LogTemp, Error, TEXT("Journal: first divergence after step %lld (expected %08x, got %08x)"), Step.StepIndex, Step.StateHash, Hash);
+				}
+				Mismatches++;
+			}
+		}
+	}
+
+	// Commands issued after the last recorded step
+	while (NextEntry < Journal->Entries.Num())
+	{
+		ApplyEntry(Journal->Entries[NextEntry++]);
+	}
+
+	if (Significance)
+	{
+		Significance->SetSimulationDeferralEnabled(true);
+	}
+
+	const double SimulationMs = (FPlatformTime::Seconds() - StartSeconds - HashSeconds) * 1000.0;
+	UE_LOG(LogTemp, Log, TEXT("Journal: replayed %d steps and %d commands in %.1f ms (%.3f ms/step), %d hash mismatches"),
+		Journal->Steps.Num(), Journal->Entries.Num(), SimulationMs, SimulationMs / FMath::Max(Journal->Steps.Num(), 1), Mismatches);
+
+	return Mismatches;
+}
+
+void USimulationJournal::ApplyEntry(const FJournalEntry& Entry)
+{
+	if (Entry.Command == EJournalCommand::SetTimeMode)
+	{
+		return;
+	}
+
+	AActor* Target = FindSimulationActor(Entry.TargetID);
+	AHydroponicsContainer* Container = Cast<AHydroponicsContainer>(Target);
+	APlantActor* Plant = Cast<APlantActor>(Target);
+
+	if (!Container && !Plant)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Journal: target %d of step %lld not found"), Entry.TargetID, Entry.StepIndex);
+		return;
+	}
+
+	switch (Entry.Command)
+	{
+	case EJournalCommand::PlantSeed:
+		if (Container) Container->ExecutePlantSeed(Entry.Argument, Entry.SlotIndex, Entry.PlayerID);
+		break;
+	case EJournalCommand::RemovePlant:
+		if (Container) Container->ExecuteRemovePlant(Entry.SlotIndex, Entry.PlayerID);
+		break;
+	case EJournalCommand::HarvestPlant:
+		if (Plant) Plant->Harvest();
+		break;
+	case EJournalCommand::SetPHLevel:
+		if (Container) Container->ExecuteSetPHLevel(Entry.Value, Entry.PlayerID);
+		break;
+	case EJournalCommand::SetECLevel:
+		if (Container) Container->ExecuteSetECLevel(Entry.Value, Entry.PlayerID);
+		break;
+	case EJournalCommand::SetWaterLevel:
+		if (Container) Container->SetWaterLevel(Entry.Value);
+		break;
+	case EJournalCommand::AddNutrients:
+		if (Container) Container->ExecuteAddNutrients(Entry.Nutrients, Entry.PlayerID);
+		break;
+	case EJournalCommand::StartWaterPump:
+		if (Container) Container->ExecuteStartWaterPump(Entry.PlayerID);
+		break;
+	case EJournalCommand::StopWaterPump:
+		if (Container) Container->ExecuteStopWaterPump(Entry.PlayerID);
+		break;
+	case EJournalCommand::SetSupplyReservoir:
+		if (Container) Container->SetSupplyReservoir(Cast<AHydroponicsContainer>(FindSimulationActor(Entry.ArgumentID)));
+		break;
+	default:
+		break;
+	}
+}
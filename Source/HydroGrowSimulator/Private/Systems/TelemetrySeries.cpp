@@ -0,0 +1,321 @@
+#include "Systems/TelemetrySeries.h"
+
+namespace
+{
+	// MSB-first bit packing into 64-bit words
+	void WriteBits(TArray<uint64>& Words, int32& NumBits, uint64 Value, int32 Count)
+	{
+		while (Count > 0)
+		{
+			const int32 WordIndex = NumBits >> 6;
+			const int32 Space = 64 - (NumBits & 63);
+			const int32 Take = FMath::Min(Space, Count);
+			if (WordIndex == Words.Num())
+			{
+				Words.Add(0);
+			}
+
+			const uint64 Mask = Take == 64 ? ~0ull : ((1ull << Take) - 1);
+			Words[WordIndex] |= ((Value >> (Count - Take)) & Mask) << (Space - Take);
+			NumBits += Take;
+			Count -= Take;
+		}
+	}
+
+	uint64 ReadBits(const TArray<uint64>& Words, int32& BitPos, int32 Count)
+	{
+		uint64 Result = 0;
+		while (Count > 0)
+		{
+			const int32 Space = 64 - (BitPos & 63);
+			const int32 Take = FMath::Min(Space, Count);
+			const uint64 Mask = Take == 64 ? ~0ull : ((1ull << Take) - 1);
+			const uint64 Chunk = (Words[BitPos >> 6] >> (Space - Take)) & Mask;
+			Result = Take == 64 ? Chunk : ((Result << Take) | Chunk);
+			BitPos += Take;
+			Count -= Take;
+		}
+		return Result;
+	}
+
+	// Prefix codes for delta-of-delta: 0 | 10+7 | 110+9 | 1110+12 | 1111+32 bits
+	void WriteDeltaOfDelta(TArray<uint64>& Words, int32& NumBits, int64 DeltaOfDelta)
+	{
+		if (DeltaOfDelta == 0)
+		{
+			WriteBits(Words, NumBits, 0b0, 1);
+		}
+		else if (DeltaOfDelta >= -63 && DeltaOfDelta <= 64)
+		{
+			WriteBits(Words, NumBits, 0b10, 2);
+			WriteBits(Words, NumBits, static_cast<uint64>(DeltaOfDelta + 63), 7);
+		}
+		else if (DeltaOfDelta >= -255 && DeltaOfDelta <= 256)
+		{
+			WriteBits(Words, NumBits, 0b110, 3);
+			WriteBits(Words, NumBits, static_cast<uint64>(DeltaOfDelta + 255), 9);
+		}
+		else if (DeltaOfDelta >= -2047 && DeltaOfDelta <= 2048)
+		{
+			WriteBits(Words, NumBits, 0b1110, 4);
+			WriteBits(Words, NumBits, static_cast<uint64>(DeltaOfDelta + 2047), 12);
+		}
+		else
+		{
+			const int32 Clamped = static_cast<int32>(FMath::Clamp<int64>(DeltaOfDelta, MIN_int32, MAX_int32));
+			WriteBits(Words, NumBits, 0b1111, 4);
+			WriteBits(Words, NumBits, static_cast<uint32>(Clamped), 32);
+		}
+	}
+
+	int64 ReadDeltaOfDelta(const TArray<uint64>& Words, int32& BitPos)
+	{
+		if (ReadBits(Words, BitPos, 1) == 0)
+		{
+			return 0;
+		}
+		if (ReadBits(Words, BitPos, 1) == 0)
+		{
+			return static_cast<int64>(ReadBits(Words, BitPos, 7)) - 63;
+		}
+		if (ReadBits(Words, BitPos, 1) == 0)
+		{
+			return static_cast<int64>(ReadBits(Words, BitPos, 9)) - 255;
+		}
+		if (ReadBits(Words, BitPos, 1) == 0)
+		{
+			return static_cast<int64>(ReadBits(Words, BitPos, 12)) - 2047;
+		}
+		return static_cast<int32>(static_cast<uint32>(ReadBits(Words, BitPos, 32)));
+	}
+
+	uint32 QuantizeToBits(float Value)
+	{
+		const float Quantized = FMath::RoundToFloat(Value * FTelemetrySeries::Quantization) / FTelemetrySeries::Quantization;
+		return BitCast<uint32>(Quantized);
+	}
+}
+
+FTelemetrySeries::FTelemetrySeries(int32 InMaxBlocks)
+{
+	OldestBlock = 0;
+	MaxBlocks = FMath::Max(1, InMaxBlocks);
+	LastTime = MIN_int64;
+}
+
+void FTelemetrySeries::Reset()
+{
+	Blocks.Empty();
+	OldestBlock = 0;
+	Encoder = FCodecState();
+	LastTime = MIN_int64;
+}
+
+FTelemetrySeries::FBlock& FTelemetrySeries::StartBlock(int64 Time)
+{
+	// Trim the finished block's growth slack before it goes read-only
+	if (Blocks.Num() > 0)
+	{
+		const int32 NewestBlock = (OldestBlock + Blocks.Num() - 1) % Blocks.Num();
+		Blocks[NewestBlock].Words.Shrink();
+	}
+
+	FBlock* Block = nullptr;
+	if (Blocks.Num() < MaxBlocks)
+	{
+		Block = &Blocks.AddDefaulted_GetRef();
+	}
+	else
+	{
+		// Ring is full: reuse the oldest block
+		Block = &Blocks[OldestBlock];
+		OldestBlock = (OldestBlock + 1) % Blocks.Num();
+		*Block = FBlock();
+	}
+
+	Block->FirstTime = Time;
+	Encoder = FCodecState();
+	return *Block;
+}
+
+void FTelemetrySeries::Append(int64 Time, const float (&Values)[NumChannels])
+{
+	if (Time <= LastTime)
+	{
+		return;
+	}
+
+	FBlock* Block = Blocks.Num() > 0 ? &Blocks[(OldestBlock + Blocks.Num() - 1) % Blocks.Num()] : nullptr;
+	if (!Block || Block->NumSamples >= SamplesPerBlock)
+	{
+		Block = &StartBlock(Time);
+	}
+
+	const bool bFirstSample = Block->NumSamples == 0;
+	if (!bFirstSample)
+	{
+		// The first timestamp lives in the block header
+		const int64 Delta = Time - Encoder.PrevTime;
+		WriteDeltaOfDelta(Block->Words, Block->NumBits, Delta - Encoder.PrevDelta);
+		Encoder.PrevDelta = Delta;
+	}
+	Encoder.PrevTime = Time;
+
+	for (int32 Channel = 0; Channel < NumChannels; Channel++)
+	{
+		const uint32 ValueBits = QuantizeToBits(Values[Channel]);
+		Block->Summary[Channel].Add(BitCast<float>(ValueBits));
+
+		if (bFirstSample)
+		{
+			WriteBits(Block->Words, Block->NumBits, ValueBits, 32);
+			Encoder.PrevValue[Channel] = ValueBits;
+			continue;
+		}
+
+		const uint32 Xor = ValueBits ^ Encoder.PrevValue[Channel];
+		Encoder.PrevValue[Channel] = ValueBits;
+		if (Xor == 0)
+		{
+			WriteBits(Block->Words, Block->NumBits, 0b0, 1);
+			continue;
+		}
+
+		const uint32 Leading = FMath::CountLeadingZeros(Xor);
+		const uint32 Trailing = FMath::CountTrailingZeros(Xor);
+		if (Encoder.bHasWindow[Channel] && Leading >= Encoder.PrevLeading[Channel] && Trailing >= Encoder.PrevTrailing[Channel])
+		{
+			// Fits the previous meaningful-bit window
+			const int32 Meaningful = 32 - Encoder.PrevLeading[Channel] - Encoder.PrevTrailing[Channel];
+			WriteBits(Block->Words, Block->NumBits, 0b10, 2);
+			WriteBits(Block->Words, Block->NumBits, Xor >> Encoder.PrevTrailing[Channel], Meaningful);
+		}
+		else
+		{
+			const int32 Meaningful = 32 - Leading - Trailing;
+			WriteBits(Block->Words, Block->NumBits, 0b11, 2);
+			WriteBits(Block->Words, Block->NumBits, Leading, 5);
+			WriteBits(Block->Words, Block->NumBits, Meaningful - 1, 5);
+			WriteBits(Block->Words, Block->NumBits, Xor >> Trailing, Meaningful);
+			Encoder.PrevLeading[Channel] = static_cast<uint8>(Leading);
+			Encoder.PrevTrailing[Channel] = static_cast<uint8>(Trailing);
+			Encoder.bHasWindow[Channel] = true;
+		}
+	}
+
+	Block->NumSamples++;
+	Block->LastTime = Time;
+	LastTime = Time;
+}
+
+void FTelemetrySeries::DecodeBlock(const FBlock& Block, int32 Channel, TFunctionRef<void(int64 Time, float Value)> Visitor) const
+{
+	FCodecState State;
+	int32 BitPos = 0;
+
+	for (int32 Sample = 0; Sample < Block.NumSamples; Sample++)
+	{
+		if (Sample == 0)
+		{
+			State.PrevTime = Block.FirstTime;
+		}
+		else
+		{
+			State.PrevDelta += ReadDeltaOfDelta(Block.Words, BitPos);
+			State.PrevTime += State.PrevDelta;
+		}
+
+		// Every channel has to be parsed to reach the next sample
+		for (int32 c = 0; c < NumChannels; c++)
+		{
+			if (Sample == 0)
+			{
+				State.PrevValue[c] = static_cast<uint32>(ReadBits(Block.Words, BitPos, 32));
+			}
+			else if (ReadBits(Block.Words, BitPos, 1) != 0)
+			{
+				if (ReadBits(Block.Words, BitPos, 1) != 0)
+				{
+					State.PrevLeading[c] = static_cast<uint8>(ReadBits(Block.Words, BitPos, 5));
+					const int32 Meaningful = static_cast<int32>(ReadBits(Block.Words, BitPos, 5)) + 1;
+					State.PrevTrailing[c] = static_cast<uint8>(32 - State.PrevLeading[c] - Meaningful);
+				}
+
+				const int32 Meaningful = 32 - State.PrevLeading[c] - State.PrevTrailing[c];
+				const uint32 Xor = static_cast<uint32>(ReadBits(Block.Words, BitPos, Meaningful)) << State.PrevTrailing[c];
+				State.PrevValue[c] ^= Xor;
+			}
+		}
+
+		Visitor(State.PrevTime, BitCast<float>(State.PrevValue[Channel]));
+	}
+}
+
+void FTelemetrySeries::Downsample(int32 Channel, int64 StartTime, int64 EndTime, TArrayView<FTelemetryAggregate> OutBuckets) const
+{
+	for (FTelemetryAggregate& Bucket : OutBuckets)
+	{
+		Bucket = FTelemetryAggregate();
+	}
+
+	const int32 NumBuckets = OutBuckets.Num();
+	if (NumBuckets == 0 || EndTime <= StartTime || Channel < 0 || Channel >= NumChannels)
+	{
+		return;
+	}
+
+	const int64 Span = EndTime - StartTime;
+	auto BucketOf = [StartTime, Span, NumBuckets](int64 Time)
+	{
+		return static_cast<int32>((Time - StartTime) * NumBuckets / Span);
+	};
+
+	for (int32 i = 0; i < Blocks.Num(); i++)
+	{
+		const FBlock& Block = Blocks[(OldestBlock + i) % Blocks.Num()];
+		if (Block.NumSamples == 0 || Block.LastTime < StartTime || Block.FirstTime >= EndTime)
+		{
+			continue;
+		}
+
+		// Whole block inside one bucket: its summary is enough
+		if (Block.FirstTime >= StartTime && Block.LastTime < EndTime && BucketOf(Block.FirstTime) == BucketOf(Block.LastTime))
+		{
+			OutBuckets[BucketOf(Block.FirstTime)].Merge(Block.Summary[Channel]);
+			continue;
+		}
+
+		DecodeBlock(Block, Channel, [&](int64 Time, float Value)
+		{
+			if (Time >= StartTime && Time < EndTime)
+			{
+				OutBuckets[BucketOf(Time)].Add(Value);
+			}
+		});
+	}
+}
+
+int32 FTelemetrySeries::GetNumSamples() const
+{
+	int32 NumSamples = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		NumSamples += Block.NumSamples;
+	}
+	return NumSamples;
+}
+
+int64 FTelemetrySeries::GetFirstTime() const
+{
+	return Blocks.Num() > 0 ? Blocks[OldestBlock].FirstTime : LastTime;
+}
+
+SIZE_T FTelemetrySeries::GetAllocatedSize() const
+{
+	SIZE_T Size = Blocks.GetAllocatedSize();
+	for (const FBlock& Block : Blocks)
+	{
+		Size += Block.Words.GetAllocatedSize();
+	}
+	return Size;
+}
@@ -1,7 +1,7 @@
 #include "Systems/TimeManager.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
-#include "TimerManager.h"
+#include "HAL/PlatformTime.h"
 
 void UTimeManager::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -11,33 +11,67 @@ void UTimeManager::Initialize(FSubsystemCollectionBase& Collection)
 	CurrentTimeMode = EGameTimeMode::Normal;
 	PreviousTimeMode = EGameTimeMode::Normal;
 	TotalGameTimeElapsed = 0.0f;
-	AccumulatedTime = 0.0f;
 	OfflineHoursProcessed = 0.0f;
+	PendingSimulationSeconds = 0.0;
+	TickRemainder = 0.0;
+	GameTicks = FGameDateTime().ToTicks();
+	CachedDateTimeTicks = INDEX_NONE;
+	GameTimers.Reset(GameTicks);
+	SimulationStepIndex = 0;
+	StepsLastFrame = 0;
+	TimersFiredLastAdvance = 0;
+	bSkippingToEvent = false;
+	bSimulationEventRaised = false;
 	
 	// Configuration
 	DayStartHour = 6.0f;
 	NightStartHour = 18.0f;
 	MaxOfflineHours = 72.0f; // Maximum 3 days of offline progression
 	
-	InitializeTimeScales();
+	// Simulation budget
+	MaxStepsPerFrame = 64;
+	SimulationBudgetMs = 4.0f;
+	MaxSimulationBacklogSeconds = 600.0f; // 10 game minutes
+	CoarseTierTimeScaleThreshold = 1000.0f; // Accelerated mode
+	CoarseStepSeconds = 3600.0f;
 	
-	// Start the game time update timer
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(GameTimeTimer, this, &UTimeManager::UpdateGameTime, 0.1f, true);
-	}
+	InitializeTimeScales();
 	
 	UE_LOG(LogTemp, Warning, TEXT("TimeManager initialized"));
 }
 
 void UTimeManager::Deinitialize()
 {
-	if (UWorld* World = GetWorld())
+	OnSimulationStep.Clear();
+	OnPredictNextEvent.Clear();
+	OnSimulationStepComplete.Clear();
+	GameTimers.Reset(GameTicks);
+	
+	Super::Deinitialize();
+}
+
+void UTimeManager::Tick(float DeltaTime)
+{
+	StepsLastFrame = 0;
+	
+	if (CurrentTimeMode == EGameTimeMode::Paused)
 	{
-		World->GetTimerManager().ClearTimer(GameTimeTimer);
+		return;
 	}
 	
-	Super::Deinitialize();
+	// Accumulate game time and consume it in fixed steps, independent of frame rate
+	PendingSimulationSeconds += static_cast<double>(DeltaTime) * GetCurrentTimeScale();
+	RunFixedSteps();
+}
+
+TStatId UTimeManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTimeManager, STATGROUP_Tickables);
+}
+
+ETickableTickType UTimeManager::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Always;
 }
 
 void UTimeManager::SetTimeMode(EGameTimeMode NewMode)
@@ -100,19 +134,41 @@ float UTimeManager::GetCurrentTimeScale() const
 
 float UTimeManager::GetTimeOfDay() const
 {
-	return CurrentGameTime.Hour + (CurrentGameTime.Minute / 60.0f) + (CurrentGameTime.Second / 3600.0f);
+	return static_cast<float>(static_cast<double>(GameTicks % FGameDateTime::TicksPerDay) / FGameDateTime::TicksPerHour);
 }
 
 int32 UTimeManager::GetCurrentDay() const
 {
-	// Calculate total days since start of game
-	int32 TotalDays = (CurrentGameTime.Year - 2025) * 365 + (CurrentGameTime.Month - 1) * 30 + (CurrentGameTime.Day - 1);
-	return TotalDays + 1; // Start from day 1
+	// Days since the epoch, starting from day 1
+	return static_cast<int32>(GameTicks / FGameDateTime::TicksPerDay) + 1;
+}
+
+FGameDateTime UTimeManager::GetGameDateTime() const
+{
+	if (CachedDateTimeTicks != GameTicks)
+	{
+		CachedDateTime = FGameDateTime::FromTicks(GameTicks);
+		CachedDateTimeTicks = GameTicks;
+	}
+	return CachedDateTime;
+}
+
+void UTimeManager::SetGameTicks(int64 NewGameTicks)
+{
+	GameTicks = FMath::Max<int64>(NewGameTicks, 0);
+	TickRemainder = 0.0;
+	PendingSimulationSeconds = 0.0;
+	
+	if (GameTimers.Num() > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Game clock reset, dropping %d pending game timers"), GameTimers.Num());
+	}
+	GameTimers.Reset(GameTicks);
 }
 
 FString UTimeManager::GetFormattedGameTime() const
 {
-	return CurrentGameTime.ToString();
+	return GetGameDateTime().ToString();
 }
 
 bool UTimeManager::IsDay() const
@@ -138,7 +194,8 @@ void UTimeManager::ProcessOfflineTime(const FDateTime& LastSaveTime)
 	
 	if (OfflineHours > 0.1f) // Only process if more than 6 minutes offline
 	{
-		AdvanceTime(OfflineHours);
+		// Simulate the gap in coarse chunks so plants and containers progress with the clock
+		SimulateCoarse(static_cast<double>(OfflineHours) * 3600.0);
 		OfflineHoursProcessed = OfflineHours;
 		
 		UE_LOG(LogTemp, Warning, TEXT("Processed %.2f hours of offline time"), OfflineHours);
@@ -151,59 +208,56 @@ void UTimeManager::ProcessOfflineTime(const FDateTime& LastSaveTime)
 
 void UTimeManager::AdvanceTime(float Hours)
 {
-	int32 PreviousDay = GetCurrentDay();
-	int32 PreviousHour = CurrentGameTime.Hour;
-	bool WasDay = IsDay();
-	
-	TotalGameTimeElapsed += Hours;
-	
-	// Convert hours to seconds and add to current time
-	float TotalSeconds = Hours * 3600.0f;
+	// Convert hours to ticks, carrying sub-tick remainders
+	double TotalTicks = static_cast<double>(Hours) * FGameDateTime::TicksPerHour + TickRemainder;
+	int64 WholeTicks = FMath::FloorToInt64(TotalTicks + UE_KINDA_SMALL_NUMBER);
+	TickRemainder = FMath::Max(TotalTicks - WholeTicks, 0.0);
 	
-	CurrentGameTime.Second += FMath::FloorToInt(TotalSeconds);
-	
-	// Handle overflow
-	if (CurrentGameTime.Second >= 60)
+	AdvanceTicks(WholeTicks);
+}
+
+void UTimeManager::AdvanceTicks(int64 Ticks)
+{
+	if (Ticks <= 0)
 	{
-		CurrentGameTime.Minute += CurrentGameTime.Second / 60;
-		CurrentGameTime.Second %= 60;
+		return;
 	}
 	
-	if (CurrentGameTime.Minute >= 60)
-	{
-		CurrentGameTime.Hour += CurrentGameTime.Minute / 60;
-		CurrentGameTime.Minute %= 60;
-	}
+	TotalGameTimeElapsed += static_cast<float>(static_cast<double>(Ticks) / FGameDateTime::TicksPerHour);
 	
-	if (CurrentGameTime.Hour >= 24)
+	// Fire game-time events in order, moving the clock to each one before it runs
+	const int64 TargetTicks = GameTicks + Ticks;
+	TimersFiredLastAdvance = GameTimers.Advance(static_cast<uint64>(TargetTicks), [this](uint64 EventTick)
 	{
-		CurrentGameTime.Day += CurrentGameTime.Hour / 24;
-		CurrentGameTime.Hour %= 24;
-	}
-	
-	// Handle month/year overflow (simplified)
-	if (CurrentGameTime.Day > 30)
+		AdvanceClock(static_cast<int64>(EventTick) - GameTicks);
+	});
+	AdvanceClock(TargetTicks - GameTicks);
+}
+
+void UTimeManager::AdvanceClock(int64 Ticks)
+{
+	if (Ticks <= 0)
 	{
-		CurrentGameTime.Month += (CurrentGameTime.Day - 1) / 30;
-		CurrentGameTime.Day = ((CurrentGameTime.Day - 1) % 30) + 1;
+		return;
 	}
 	
-	if (CurrentGameTime.Month > 12)
-	{
-		CurrentGameTime.Year += (CurrentGameTime.Month - 1) / 12;
-		CurrentGameTime.Month = ((CurrentGameTime.Month - 1) % 12) + 1;
-	}
+	const int64 PreviousDayIndex = GameTicks / FGameDateTime::TicksPerDay;
+	const int64 PreviousHourIndex = GameTicks / FGameDateTime::TicksPerHour;
+	bool WasDay = IsDay();
+	
+	GameTicks += Ticks;
 	
 	// Broadcast events
-	int32 NewDay = GetCurrentDay();
-	if (NewDay != PreviousDay)
+	const int64 NewDayIndex = GameTicks / FGameDateTime::TicksPerDay;
+	if (NewDayIndex != PreviousDayIndex)
 	{
-		OnNewDay.Broadcast(NewDay);
+		OnNewDay.Broadcast(GetCurrentDay());
 	}
 	
-	if (CurrentGameTime.Hour != PreviousHour)
+	const int64 NewHourIndex = GameTicks / FGameDateTime::TicksPerHour;
+	if (NewHourIndex != PreviousHourIndex)
 	{
-		OnHourChanged.Broadcast(CurrentGameTime.Hour);
+		OnHourChanged.Broadcast(static_cast<int32>(NewHourIndex % 24));
 	}
 	
 	bool IsCurrentlyDay = IsDay();
@@ -213,25 +267,175 @@ void UTimeManager::AdvanceTime(float Hours)
 	}
 }
 
-void UTimeManager::UpdateGameTime()
+FGameTimerHandle UTimeManager::ScheduleGameTimer(double DelayGameSeconds, FSimpleDelegate Callback)
 {
-	if (CurrentTimeMode == EGameTimeMode::Paused)
+	const int64 DelayTicks = FMath::Max<int64>(FMath::CeilToInt64(DelayGameSeconds * FGameDateTime::TicksPerSecond), 1);
+	return GameTimers.Schedule(static_cast<uint64>(GameTicks + DelayTicks), MoveTemp(Callback));
+}
+
+FGameTimerHandle UTimeManager::ScheduleGameTimerAt(int64 GameTick, FSimpleDelegate Callback)
+{
+	return GameTimers.Schedule(static_cast<uint64>(FMath::Max<int64>(GameTick, 0)), MoveTemp(Callback));
+}
+
+FGameTimerHandle UTimeManager::ScheduleGameEvent(float DelayGameHours, FOnGameTimerEvent Event)
+{
+	return ScheduleGameTimer(DelayGameHours * 3600.0, FSimpleDelegate::CreateWeakLambda(this, [Event]()
 	{
-		return;
+		Event.ExecuteIfBound();
+	}));
+}
+
+bool UTimeManager::CancelGameTimer(FGameTimerHandle& Handle)
+{
+	return GameTimers.Cancel(Handle);
+}
+
+bool UTimeManager::IsGameTimerActive(const FGameTimerHandle& Handle) const
+{
+	return GameTimers.IsScheduled(Handle);
+}
+
+float UTimeManager::GetGameTimerRemaining(const FGameTimerHandle& Handle) const
+{
+	uint64 DeadlineTick = 0;
+	if (!GameTimers.GetDeadline(Handle, DeadlineTick))
+	{
+		return -1.0f;
+	}
+	const int64 RemainingTicks = FMath::Max<int64>(static_cast<int64>(DeadlineTick) - GameTicks, 0);
+	return static_cast<float>(static_cast<double>(RemainingTicks) / FGameDateTime::TicksPerSecond);
+}
+
+float UTimeManager::GetFixedStepSeconds() const
+{
+	// In the coarse tier this is the smallest chunk; RunFixedSteps grows chunks up to CoarseStepSeconds
+	const float* StepSeconds = TimeModeStepSeconds.Find(CurrentTimeMode);
+	return StepSeconds ? *StepSeconds : 1.0f;
+}
+
+ESimulationTier UTimeManager::GetCurrentSimulationTier() const
+{
+	return GetCurrentTimeScale() >= CoarseTierTimeScaleThreshold ? ESimulationTier::Coarse : ESimulationTier::Fine;
+}
+
+float UTimeManager::SkipToNextEvent(float MaxHours)
+{
+	if (bSkippingToEvent || MaxHours <= 0.0f)
+	{
+		return 0.0f;
 	}
 	
-	float TimeScale = GetCurrentTimeScale();
-	float DeltaTime = 0.1f; // Timer interval
+	TGuardValue<bool> SkipGuard(bSkippingToEvent, true);
+	bSimulationEventRaised = false;
 	
-	AccumulatedTime += DeltaTime * TimeScale;
+	// Anything accumulated for the fixed-step loop is covered by the skip
+	PendingSimulationSeconds = 0.0;
 	
-	// Convert to game hours and advance time
-	float GameHours = AccumulatedTime / 3600.0f;
-	if (GameHours >= 0.01f) // Update every 0.01 game hours (36 seconds)
+	const double MaxSeconds = static_cast<double>(MaxHours) * 3600.0;
+	double SkippedSeconds = 0.0;
+	
+	while (SkippedSeconds < MaxSeconds)
 	{
-		AdvanceTime(GameHours);
-		AccumulatedTime = 0.0f;
+		// Land each chunk on the next predicted event or game timer, whichever comes first
+		double ChunkSeconds = MaxSeconds - SkippedSeconds;
+		OnPredictNextEvent.Broadcast(ChunkSeconds);
+		
+		uint64 NextTimerTick = 0;
+		if (GameTimers.PeekNextDeadline(NextTimerTick))
+		{
+			const double SecondsToTimer = static_cast<double>(static_cast<int64>(NextTimerTick) - GameTicks) / FGameDateTime::TicksPerSecond;
+			ChunkSeconds = FMath::Min(ChunkSeconds, SecondsToTimer);
+		}
+		
+		ChunkSeconds = FMath::Clamp(ChunkSeconds, 1.0, static_cast<double>(CoarseStepSeconds));
+		ChunkSeconds = FMath::Min(ChunkSeconds, MaxSeconds - SkippedSeconds);
+		
+		StepSimulation(static_cast<float>(ChunkSeconds), ESimulationTier::Coarse);
+		SkippedSeconds += ChunkSeconds;
+		
+		if (bSimulationEventRaised || TimersFiredLastAdvance > 0)
+		{
+			break;
+		}
 	}
+	
+	UE_LOG(LogTemp, Log, TEXT("Skipped %.2f game hours to %s"), SkippedSeconds / 3600.0, *GetFormattedGameTime());
+	return static_cast<float>(SkippedSeconds / 3600.0);
+}
+
+void UTimeManager::NotifySimulationEvent()
+{
+	bSimulationEventRaised = true;
+}
+
+void UTimeManager::SimulateCoarse(double Seconds)
+{
+	double Remaining = Seconds;
+	while (Remaining > UE_KINDA_SMALL_NUMBER)
+	{
+		const double ChunkSeconds = FMath::Min(Remaining, static_cast<double>(CoarseStepSeconds));
+		StepSimulation(static_cast<float>(ChunkSeconds), ESimulationTier::Coarse);
+		Remaining -= ChunkSeconds;
+	}
+}
+
+void UTimeManager::SetFixedStepSeconds(EGameTimeMode Mode, float StepSeconds)
+{
+	TimeModeStepSeconds.Add(Mode, FMath::Max(StepSeconds, 0.01f));
+}
+
+void UTimeManager::RunFixedSteps()
+{
+	const ESimulationTier Tier = GetCurrentSimulationTier();
+	const float StepSeconds = GetFixedStepSeconds();
+	const double Deadline = FPlatformTime::Seconds() + SimulationBudgetMs / 1000.0;
+	
+	// Run as many whole steps as the frame budget allows; the remainder carries over
+	while (PendingSimulationSeconds >= StepSeconds && StepsLastFrame < MaxStepsPerFrame)
+	{
+		// Coarse steps integrate in closed form, so one step takes this frame's pending time (up to
+		// CoarseStepSeconds) and the clock moves every frame rather than an hour at a time
+		float ChunkSeconds = StepSeconds;
+		if (Tier == ESimulationTier::Coarse)
+		{
+			const double MaxChunkSeconds = FMath::Max(CoarseStepSeconds, StepSeconds);
+			ChunkSeconds = static_cast<float>(FMath::Min(PendingSimulationSeconds, MaxChunkSeconds));
+		}
+		
+		StepSimulation(ChunkSeconds, Tier);
+		PendingSimulationSeconds -= ChunkSeconds;
+		StepsLastFrame++;
+		
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+	
+	// If the CPU can't keep up, slow game time down rather than spiral, always allowing at least
+	// one step to accumulate
+	const double MaxBacklogSeconds = FMath::Max(MaxSimulationBacklogSeconds, StepSeconds);
+	if (PendingSimulationSeconds > MaxBacklogSeconds)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Simulation behind by %.1f game seconds, dropping backlog"), PendingSimulationSeconds);
+		PendingSimulationSeconds = MaxBacklogSeconds;
+	}
+}
+
+void UTimeManager::StepSimulation(float StepSeconds, ESimulationTier Tier)
+{
+	FSimulationStepContext Step;
+	Step.StepIndex = SimulationStepIndex++;
+	Step.DeltaGameSeconds = StepSeconds;
+	Step.Tier = Tier;
+	
+	OnSimulationStep.Broadcast(Step);
+	
+	// The game clock only moves by simulated time, so clock and state never disagree
+	AdvanceTicks(FMath::RoundToInt64(static_cast<double>(StepSeconds) * FGameDateTime::TicksPerSecond));
+	
+	OnSimulationStepComplete.Broadcast(Step);
 }
 
 void UTimeManager::InitializeTimeScales()
@@ -242,6 +446,15 @@ void UTimeManager::InitializeTimeScales()
 	TimeModeScales.Add(EGameTimeMode::Fast, 120.0f);         // 2x speed
 	TimeModeScales.Add(EGameTimeMode::VeryFast, 240.0f);     // 4x speed
 	TimeModeScales.Add(EGameTimeMode::Accelerated, 1440.0f); // 1 real minute = 1 game day
+	
+	// Step sizes in game seconds. Accelerated runs in the coarse tier, where this is the smallest
+	// chunk: pending time below it waits for the next frame.
+	TimeModeStepSeconds.Empty();
+	TimeModeStepSeconds.Add(EGameTimeMode::Paused, 1.0f);
+	TimeModeStepSeconds.Add(EGameTimeMode::Normal, 1.0f);
+	TimeModeStepSeconds.Add(EGameTimeMode::Fast, 1.0f);
+	TimeModeStepSeconds.Add(EGameTimeMode::VeryFast, 2.0f);
+	TimeModeStepSeconds.Add(EGameTimeMode::Accelerated, 5.0f);
 }
 
 void UTimeManager::BroadcastTimeEvents()
@@ -0,0 +1,146 @@
+#include "Systems/GameTimerWheel.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameTimerWheelOrderTest, "HydroGrow.Systems.GameTimerWheel.DeadlineOrder",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGameTimerWheelOrderTest::RunTest(const FString& Parameters)
+{
+	constexpr uint64 StartTick = 12345;
+	FGameTimerWheel Wheel;
+	Wheel.Reset(StartTick);
+
+	// Deadlines on every level, on slot boundaries and past the wheel's 2^40 tick horizon
+	TArray<uint64> Deadlines;
+	FRandomStream Random(42);
+	for (int32 Level = 0; Level < 6; Level++)
+	{
+		const uint64 LevelSpan = 1ull << (8 * Level);
+		for (int32 i = 0; i < 40; i++)
+		{
+			const uint64 Offset = LevelSpan + static_cast<uint64>(Random.RandRange(0, 255)) * LevelSpan + static_cast<uint64>(Random.RandRange(0, 255));
+			Deadlines.Add(StartTick + Offset);
+		}
+		Deadlines.Add(StartTick + LevelSpan * 256);
+		Deadlines.Add(StartTick + LevelSpan * 256 - 1);
+	}
+	Deadlines.Add(StartTick);
+	Deadlines.Add(StartTick + 1);
+	Deadlines.Add(StartTick + 1);
+
+	// Deadlines at or before the current tick are due on the next tick
+	for (uint64& Deadline : Deadlines)
+	{
+		Deadline = FMath::Max(Deadline, StartTick + 1);
+	}
+
+	uint64 ReachedTick = StartTick;
+	TArray<uint64> Fired;
+	TArray<FGameTimerHandle> Handles;
+	for (const uint64 Deadline : Deadlines)
+	{
+		Handles.Add(Wheel.Schedule(Deadline, FSimpleDelegate::CreateLambda([&Fired, &ReachedTick, Deadline, this]()
+		{
+			TestEqual(TEXT("Clock reads the deadline while the callback runs"), ReachedTick, Deadline);
+			Fired.Add(Deadline);
+		})));
+	}
+	TestEqual(TEXT("Scheduled"), Wheel.Num(), Deadlines.Num());
+
+	// Cancel every fifth timer; cancelled handles are dead for good
+	TArray<uint64> Expected;
+	for (int32 i = 0; i < Handles.Num(); i++)
+	{
+		if (i % 5 == 0)
+		{
+			TestTrue(TEXT("Cancel pending timer"), Wheel.Cancel(Handles[i]));
+			TestFalse(TEXT("Handle invalidated"), Handles[i].IsValid());
+			TestFalse(TEXT("Cancel twice"), Wheel.Cancel(Handles[i]));
+		}
+		else
+		{
+			uint64 Deadline = 0;
+			TestTrue(TEXT("Deadline known"), Wheel.GetDeadline(Handles[i], Deadline));
+			TestEqual(TEXT("Deadline"), Deadline, Deadlines[i]);
+			Expected.Add(Deadlines[i]);
+		}
+	}
+	Expected.Sort();
+
+	// Advance in uneven jumps, small ones first, then straight past the overflow list
+	const uint64 Jumps[] = { 0, 1, 200, 256, 70000, 1ull << 20, 1ull << 33, 1ull << 41, 1ull << 49 };
+	for (const uint64 Jump : Jumps)
+	{
+		const uint64 TargetTick = StartTick + Jump;
+
+		uint64 NextDeadline = 0;
+		const bool bHasNext = Wheel.PeekNextDeadline(NextDeadline);
+		const int32 FiredBefore = Fired.Num();
+		TestEqual(TEXT("Peek finds a pending timer"), bHasNext, FiredBefore < Expected.Num());
+		if (bHasNext && FiredBefore < Expected.Num())
+		{
+			TestEqual(TEXT("Peek returns the earliest deadline"), NextDeadline, Expected[FiredBefore]);
+		}
+
+		const int32 Count = Wheel.Advance(TargetTick, [&ReachedTick](uint64 Tick) { ReachedTick = Tick; });
+		TestEqual(TEXT("Advance reports callbacks fired"), Count, Fired.Num() - FiredBefore);
+		TestEqual(TEXT("Current tick"), Wheel.GetCurrentTick(), TargetTick);
+
+		for (const uint64 Deadline : Expected)
+		{
+			if (Deadline > TargetTick)
+			{
+				break;
+			}
+			TestTrue(TEXT("Due timers have fired"), Fired.Contains(Deadline));
+		}
+	}
+
+	TestEqual(TEXT("Every live timer fired once"), Fired.Num(), Expected.Num());
+	TestEqual(TEXT("Deadline order"), Fired, Expected);
+	TestEqual(TEXT("Wheel empty"), Wheel.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameTimerWheelHandleTest, "HydroGrow.Systems.GameTimerWheel.Handles",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGameTimerWheelHandleTest::RunTest(const FString& Parameters)
+{
+	FGameTimerWheel Wheel;
+	Wheel.Reset(0);
+
+	int32 Calls = 0;
+	FGameTimerHandle First = Wheel.Schedule(10, FSimpleDelegate::CreateLambda([&Calls]() { Calls++; }));
+	TestTrue(TEXT("Scheduled"), Wheel.IsScheduled(First));
+
+	Wheel.Advance(10);
+	TestEqual(TEXT("Fired"), Calls, 1);
+	TestFalse(TEXT("Fired timer is no longer scheduled"), Wheel.IsScheduled(First));
+
+	// The freed node is reused; the old handle must not resolve to the new timer
+	FGameTimerHandle Second = Wheel.Schedule(20, FSimpleDelegate::CreateLambda([&Calls]() { Calls++; }));
+	TestFalse(TEXT("Stale handle"), Wheel.IsScheduled(First));
+	TestFalse(TEXT("Stale handle cannot cancel"), Wheel.Cancel(First));
+	TestTrue(TEXT("New timer unaffected"), Wheel.IsScheduled(Second));
+
+	// Nothing runs before its deadline
+	Wheel.Advance(19);
+	TestEqual(TEXT("Not yet due"), Calls, 1);
+	Wheel.Advance(20);
+	TestEqual(TEXT("Second fired"), Calls, 2);
+
+	// Reset drops everything
+	FGameTimerHandle Third = Wheel.Schedule(100, FSimpleDelegate::CreateLambda([&Calls]() { Calls++; }));
+	Wheel.Reset(50);
+	TestFalse(TEXT("Reset drops timers"), Wheel.IsScheduled(Third));
+	Wheel.Advance(1000);
+	TestEqual(TEXT("Dropped timer never fires"), Calls, 2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
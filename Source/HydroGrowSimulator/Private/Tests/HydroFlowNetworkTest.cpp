@@ -0,0 +1,143 @@
+#include "Systems/HydroFlowNetwork.h"
+#include "Systems/ContainerChemistry.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FFlowTotals
+	{
+		double Water = 0.0;
+		double Nitrogen = 0.0;
+		double Phosphorus = 0.0;
+		double Potassium = 0.0;
+	};
+
+	FFlowTotals SumTotals(TConstArrayView<FContainerChemistryState> States)
+	{
+		FFlowTotals Totals;
+		for (const FContainerChemistryState& State : States)
+		{
+			const double Volume = static_cast<double>(State.WaterCapacity) * State.WaterLevel;
+			Totals.Water += Volume;
+			Totals.Nitrogen += Volume * State.Nitrogen;
+			Totals.Phosphorus += Volume * State.Phosphorus;
+			Totals.Potassium += Volume * State.Potassium;
+		}
+		return Totals;
+	}
+
+	FContainerChemistryState MakeFlowState(float Capacity, float Level, float Conductance, float Nitrogen)
+	{
+		FContainerChemistryState State;
+		State.WaterCapacity = Capacity;
+		State.WaterLevel = Level;
+		State.FlowConductance = Conductance;
+		State.Nitrogen = Nitrogen;
+		State.Phosphorus = Nitrogen * 0.5f;
+		State.Potassium = Nitrogen * 1.5f;
+		return State;
+	}
+
+	// A reservoir feeding five containers, one of them feeding another in turn, plus an empty
+	// container, a pump that is off and an unplumbed container
+	void MakeTestNetwork(TArray<int32>& OutSupply, TArray<FContainerChemistryState>& OutStates)
+	{
+		OutSupply = { INDEX_NONE, 0, 0, 0, 0, 0, 1, INDEX_NONE, 0 };
+		OutStates.Reset();
+		OutStates.Add(MakeFlowState(1000.0f, 0.9f, 0.0f, 200.0f));	// Reservoir
+		OutStates.Add(MakeFlowState(50.0f, 0.4f, 120.0f, 150.0f));
+		OutStates.Add(MakeFlowState(80.0f, 0.7f, 60.0f, 100.0f));
+		OutStates.Add(MakeFlowState(20.0f, 0.95f, 400.0f, 250.0f));
+		OutStates.Add(MakeFlowState(100.0f, 0.2f, 0.0f, 180.0f));		// Pump off
+		OutStates.Add(MakeFlowState(35.0f, 0.6f, 5.0f, 50.0f));
+		OutStates.Add(MakeFlowState(25.0f, 0.3f, 90.0f, 120.0f));		// Fed by container 1
+		OutStates.Add(MakeFlowState(60.0f, 0.5f, 0.0f, 140.0f));		// Unplumbed
+		OutStates.Add(MakeFlowState(40.0f, 0.0f, 200.0f, 0.0f));		// Empty
+	}
+
+	void TestConserved(FAutomationTestBase& Test, const TCHAR* What, double Before, double After)
+	{
+		// Levels and concentrations are stored as floats, so allow float rounding on top of the solver tolerance
+		Test.TestEqual(What, After, Before, 1.0e-5 * FMath::Max(FMath::Abs(Before), 1.0));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHydroFlowNetworkConservationTest, "HydroGrow.Systems.HydroFlowNetwork.MassConservation",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHydroFlowNetworkConservationTest::RunTest(const FString& Parameters)
+{
+	TArray<int32> Supply;
+	TArray<FContainerChemistryState> States;
+	MakeTestNetwork(Supply, States);
+
+	FHydroFlowNetwork Network;
+	Network.SetTopology(Supply);
+	TestEqual(TEXT("Edges"), Network.GetNumEdges(), 7);
+
+	const FContainerChemistryState Unplumbed = States[7];
+	const FContainerChemistryState PumpOff = States[4];
+
+	// Fine steps, then coarse hour-long steps where the implicit solve matters most
+	const float StepSeconds[] = { 1.0f, 1.0f, 60.0f, 600.0f, 3600.0f, 3600.0f, 3600.0f, 3600.0f };
+	for (const float DeltaTime : StepSeconds)
+	{
+		const FFlowTotals Before = SumTotals(States);
+		Network.Step(States, DeltaTime);
+		const FFlowTotals After = SumTotals(States);
+
+		TestConserved(*this, TEXT("Water"), Before.Water, After.Water);
+		TestConserved(*this, TEXT("Nitrogen"), Before.Nitrogen, After.Nitrogen);
+		TestConserved(*this, TEXT("Phosphorus"), Before.Phosphorus, After.Phosphorus);
+		TestConserved(*this, TEXT("Potassium"), Before.Potassium, After.Potassium);
+		TestTrue(TEXT("Solver converged"), Network.GetLastIterations() < Network.MaxIterations);
+
+		for (const FContainerChemistryState& State : States)
+		{
+			TestTrue(TEXT("Level stays in range"), State.WaterLevel >= 0.0f && State.WaterLevel <= 1.0f);
+			TestTrue(TEXT("Concentration stays non-negative"), State.Nitrogen >= 0.0f);
+		}
+	}
+
+	TestEqual(TEXT("Unplumbed level"), States[7].WaterLevel, Unplumbed.WaterLevel);
+	TestEqual(TEXT("Unplumbed nitrogen"), States[7].Nitrogen, Unplumbed.Nitrogen);
+	TestEqual(TEXT("Pump off level"), States[4].WaterLevel, PumpOff.WaterLevel);
+	TestTrue(TEXT("Empty container filled from the reservoir"), States[8].WaterLevel > 0.0f && States[8].Nitrogen > 0.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHydroFlowNetworkUniformTest, "HydroGrow.Systems.HydroFlowNetwork.UniformConcentration",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHydroFlowNetworkUniformTest::RunTest(const FString& Parameters)
+{
+	TArray<int32> Supply;
+	TArray<FContainerChemistryState> States;
+	MakeTestNetwork(Supply, States);
+
+	// Equal concentrations everywhere: moving water around must not change them
+	for (FContainerChemistryState& State : States)
+	{
+		State.Nitrogen = 150.0f;
+		State.Phosphorus = 50.0f;
+		State.Potassium = 200.0f;
+	}
+
+	FHydroFlowNetwork Network;
+	Network.SetTopology(Supply);
+	Network.Step(States, 3600.0f);
+
+	for (const FContainerChemistryState& State : States)
+	{
+		TestEqual(TEXT("Nitrogen"), State.Nitrogen, 150.0f, 1.0e-2f);
+		TestEqual(TEXT("Phosphorus"), State.Phosphorus, 50.0f, 1.0e-2f);
+		TestEqual(TEXT("Potassium"), State.Potassium, 200.0f, 1.0e-2f);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,142 @@
+#include "Systems/TelemetrySeries.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FTelemetryTestSample
+	{
+		int64 Time;
+		float Values[FTelemetrySeries::NumChannels];
+	};
+
+	float QuantizeForTest(float Value)
+	{
+		return FMath::RoundToFloat(Value * FTelemetrySeries::Quantization) / FTelemetrySeries::Quantization;
+	}
+
+	// Intervals covering every delta-of-delta code: repeats, then jumps into each range, including
+	// the 32-bit escape both ways
+	const int64 TestIntervals[] = { 10, 10, 10, 50, 50, 300, 300, 2000, 2000, 70000, 10, 10, 3, 1 };
+
+	void AppendTestSamples(FTelemetrySeries& Series, TArray<FTelemetryTestSample>& OutSamples, int32 NumSamples)
+	{
+		FRandomStream Random(1234);
+		int64 Time = 1000;
+		for (int32 i = 0; i < NumSamples; i++)
+		{
+			FTelemetryTestSample& Sample = OutSamples.AddDefaulted_GetRef();
+			Sample.Time = Time;
+			Time += TestIntervals[i % UE_ARRAY_COUNT(TestIntervals)];
+
+			Sample.Values[0] = 6.0f + 0.5f * FMath::Sin(i * 0.1f);				// Slow drift
+			Sample.Values[1] = 1.8f;											// Constant
+			Sample.Values[2] = Random.FRandRange(-100.0f, 100.0f);				// Noise
+			Sample.Values[3] = i % 7 == 0 ? 0.0f : 42.0f;						// Steps
+			Sample.Values[4] = -3.25f * i;										// Ramp through zero
+			Sample.Values[5] = Random.FRandRange(0.0f, 1.0f) * 1.0e5f;			// Wide range
+			Sample.Values[6] = i % 2 == 0 ? 1.0f : -1.0f;						// Sign flips
+			Sample.Values[7] = static_cast<float>(i & 0xff) / 256.0f;			// Exactly representable
+
+			Series.Append(Sample.Time, Sample.Values);
+		}
+	}
+
+	// Decodes each retained sample through a one-tick Downsample and compares it to the input
+	void TestRoundTrip(FAutomationTestBase& Test, const FTelemetrySeries& Series, TConstArrayView<FTelemetryTestSample> Expected)
+	{
+		FTelemetryAggregate Bucket;
+		for (const FTelemetryTestSample& Sample : Expected)
+		{
+			for (int32 Channel = 0; Channel < FTelemetrySeries::NumChannels; Channel++)
+			{
+				Series.Downsample(Channel, Sample.Time, Sample.Time + 1, MakeArrayView(&Bucket, 1));
+				if (!Test.TestEqual(FString::Printf(TEXT("Sample count at %lld"), Sample.Time), Bucket.Count, 1))
+				{
+					return;
+				}
+
+				const float ExpectedValue = QuantizeForTest(Sample.Values[Channel]);
+				if (!Test.TestEqual(FString::Printf(TEXT("Channel %d at %lld"), Channel, Sample.Time), Bucket.Min, ExpectedValue, 0.0f))
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTelemetrySeriesRoundTripTest, "HydroGrow.Systems.TelemetrySeries.RoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTelemetrySeriesRoundTripTest::RunTest(const FString& Parameters)
+{
+	FTelemetrySeries Series(16);
+	TArray<FTelemetryTestSample> Samples;
+	AppendTestSamples(Series, Samples, FTelemetrySeries::SamplesPerBlock * 3 + 17);
+
+	TestEqual(TEXT("Samples retained"), Series.GetNumSamples(), Samples.Num());
+	TestEqual(TEXT("First time"), Series.GetFirstTime(), Samples[0].Time);
+	TestEqual(TEXT("Last time"), Series.GetLastTime(), Samples.Last().Time);
+
+	TestRoundTrip(*this, Series, Samples);
+
+	// One bucket over everything mixes block summaries with decoded edges
+	for (int32 Channel = 0; Channel < FTelemetrySeries::NumChannels; Channel++)
+	{
+		FTelemetryAggregate Expected;
+		for (const FTelemetryTestSample& Sample : Samples)
+		{
+			Expected.Add(QuantizeForTest(Sample.Values[Channel]));
+		}
+
+		FTelemetryAggregate Bucket;
+		Series.Downsample(Channel, Series.GetFirstTime(), Series.GetLastTime() + 1, MakeArrayView(&Bucket, 1));
+		TestEqual(TEXT("Aggregate count"), Bucket.Count, Expected.Count);
+		TestEqual(TEXT("Aggregate min"), Bucket.Min, Expected.Min);
+		TestEqual(TEXT("Aggregate max"), Bucket.Max, Expected.Max);
+		TestEqual(TEXT("Aggregate sum"), Bucket.Sum, Expected.Sum, 1.0e-6 * FMath::Max(FMath::Abs(Expected.Sum), 1.0));
+	}
+
+	// Out-of-order samples are dropped
+	const float Values[FTelemetrySeries::NumChannels] = {};
+	Series.Append(Samples.Last().Time, Values);
+	TestEqual(TEXT("Duplicate time ignored"), Series.GetNumSamples(), Samples.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTelemetrySeriesRingWrapTest, "HydroGrow.Systems.TelemetrySeries.RingWrap",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTelemetrySeriesRingWrapTest::RunTest(const FString& Parameters)
+{
+	// Five blocks' worth through a ring of two: the newest full block and the partial one remain
+	constexpr int32 MaxBlocks = 2;
+	constexpr int32 PartialSamples = 9;
+	FTelemetrySeries Series(MaxBlocks);
+	TArray<FTelemetryTestSample> Samples;
+	AppendTestSamples(Series, Samples, FTelemetrySeries::SamplesPerBlock * 4 + PartialSamples);
+
+	const int32 NumRetained = FTelemetrySeries::SamplesPerBlock + PartialSamples;
+	const TConstArrayView<FTelemetryTestSample> Retained = MakeArrayView(Samples).Slice(Samples.Num() - NumRetained, NumRetained);
+
+	TestEqual(TEXT("Samples retained"), Series.GetNumSamples(), NumRetained);
+	TestEqual(TEXT("First time after wrap"), Series.GetFirstTime(), Retained[0].Time);
+	TestEqual(TEXT("Last time"), Series.GetLastTime(), Samples.Last().Time);
+
+	TestRoundTrip(*this, Series, Retained);
+
+	// Nothing older than the ring is reported
+	FTelemetryAggregate Bucket;
+	Series.Downsample(0, Samples[0].Time, Retained[0].Time, MakeArrayView(&Bucket, 1));
+	TestEqual(TEXT("Evicted samples"), Bucket.Count, 0);
+
+	Series.Reset();
+	TestEqual(TEXT("Samples after reset"), Series.GetNumSamples(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,105 @@
+#include "Core/UnlockCatalog.h"
+#include "Core/HydroGrowTypes.h"
+#include "Engine/DataTable.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FTestUnlockRow
+	{
+		const TCHAR* Name;
+		int32 UnlockLevel;
+	};
+
+	UDataTable* MakePlantTable(TConstArrayView<FTestUnlockRow> Rows)
+	{
+		UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+		Table->RowStruct = FPlantSpeciesData::StaticStruct();
+		for (const FTestUnlockRow& Row : Rows)
+		{
+			FPlantSpeciesData Data;
+			Data.UnlockLevel = Row.UnlockLevel;
+			Table->AddRow(Row.Name, Data);
+		}
+		return Table;
+	}
+
+	int32 GetPlantUnlockLevel(const uint8* Row)
+	{
+		return reinterpret_cast<const FPlantSpeciesData*>(Row)->UnlockLevel;
+	}
+
+	bool UnlockedNamesEqual(TConstArrayView<FName> Unlocked, TConstArrayView<FName> Expected)
+	{
+		if (Unlocked.Num() != Expected.Num())
+		{
+			return false;
+		}
+		for (int32 i = 0; i < Expected.Num(); i++)
+		{
+			if (Unlocked[i] != Expected[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnlockCatalogPrefixTest, "HydroGrow.Core.UnlockCatalog.LevelPrefixes",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FUnlockCatalogPrefixTest::RunTest(const FString& Parameters)
+{
+	// Unsorted levels with gaps at 3 and 5, and ties that must keep table order
+	const FTestUnlockRow Rows[] =
+	{
+		{ TEXT("Tomato"), 4 },
+		{ TEXT("Lettuce"), 2 },
+		{ TEXT("Basil"), 2 },
+		{ TEXT("Pepper"), 6 },
+		{ TEXT("Spinach"), 4 },
+		{ TEXT("Kale"), 2 },
+	};
+	UDataTable* Table = MakePlantTable(Rows);
+
+	FUnlockCatalog Catalog;
+	Catalog.Build(Table, GetPlantUnlockLevel);
+
+	const FName Level2[] = { TEXT("Lettuce"), TEXT("Basil"), TEXT("Kale") };
+	const FName Level4[] = { TEXT("Lettuce"), TEXT("Basil"), TEXT("Kale"), TEXT("Tomato"), TEXT("Spinach") };
+	const FName All[] = { TEXT("Lettuce"), TEXT("Basil"), TEXT("Kale"), TEXT("Tomato"), TEXT("Spinach"), TEXT("Pepper") };
+
+	TestTrue(TEXT("All rows in level order"), UnlockedNamesEqual(Catalog.GetAll(), All));
+
+	// Below the first level, on each boundary, inside each gap and past the last level
+	TestEqual(TEXT("Level 0"), Catalog.GetUnlocked(0).Num(), 0);
+	TestEqual(TEXT("Level 1"), Catalog.GetUnlocked(1).Num(), 0);
+	TestTrue(TEXT("Level 2"), UnlockedNamesEqual(Catalog.GetUnlocked(2), Level2));
+	TestTrue(TEXT("Level 3 gap"), UnlockedNamesEqual(Catalog.GetUnlocked(3), Level2));
+	TestTrue(TEXT("Level 4"), UnlockedNamesEqual(Catalog.GetUnlocked(4), Level4));
+	TestTrue(TEXT("Level 5 gap"), UnlockedNamesEqual(Catalog.GetUnlocked(5), Level4));
+	TestTrue(TEXT("Level 6"), UnlockedNamesEqual(Catalog.GetUnlocked(6), All));
+	TestTrue(TEXT("Past the last level"), UnlockedNamesEqual(Catalog.GetUnlocked(100), All));
+	TestEqual(TEXT("Negative level"), Catalog.GetUnlocked(-1).Num(), 0);
+
+	// Rebuilding from an empty table or none at all leaves nothing unlocked
+	Catalog.Build(MakePlantTable(TConstArrayView<FTestUnlockRow>()), GetPlantUnlockLevel);
+	TestEqual(TEXT("Empty table"), Catalog.GetUnlocked(100).Num(), 0);
+	Catalog.Build(nullptr, GetPlantUnlockLevel);
+	TestEqual(TEXT("No table"), Catalog.GetAll().Num(), 0);
+
+	// A single level
+	const FTestUnlockRow SingleLevel[] = { { TEXT("Mint"), 1 }, { TEXT("Chive"), 1 } };
+	Catalog.Build(MakePlantTable(SingleLevel), GetPlantUnlockLevel);
+	TestEqual(TEXT("Single level, below"), Catalog.GetUnlocked(0).Num(), 0);
+	TestEqual(TEXT("Single level, at"), Catalog.GetUnlocked(1).Num(), 2);
+	TestEqual(TEXT("Single level, above"), Catalog.GetUnlocked(7).Num(), 2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
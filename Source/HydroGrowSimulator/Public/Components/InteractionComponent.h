@@ -60,6 +60,31 @@ public:
 	void OnInteractionEnd(AHydroGrowCharacter* Character);
 };
 
+// How instances of a class take part in interaction
+enum class EInteractableKind : uint8
+{
+	None,
+	Interface,
+	Container,
+	Plant
+};
+
+/**
+ * Interaction descriptor resolved once per UClass, so candidate filtering and dispatch cost a map
+ * lookup instead of an interface search and IsA chain per actor per query. The interface takes
+ * precedence over the native container/plant paths.
+ */
+struct HYDROGROWSIMULATOR_API FInteractableClassInfo
+{
+	EInteractableKind Kind = EInteractableKind::None;
+
+	bool IsInteractable() const { return Kind != EInteractableKind::None; }
+	bool UsesInterface() const { return Kind == EInteractableKind::Interface; }
+
+	static FInteractableClassInfo Get(const UClass* Class);
+	static FInteractableClassInfo Get(const AActor* Actor) { return Get(Actor->GetClass()); }
+};
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class HYDROGROWSIMULATOR_API UInteractionComponent : public USphereComponent
 {
@@ -70,6 +95,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// Interaction settings
@@ -112,9 +138,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	bool CanInteractWithActor(AActor* Actor) const;
 
+	// Cached per actor until the actor calls NotifyInteractionDataChanged
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	FInteractionData GetInteractionDataForActor(AActor* Actor) const;
 
+	// Interactables call this when the result of GetInteractionData changes
+	UFUNCTION(BlueprintCallable, Category = "Interaction", meta = (DefaultToSelf = "Actor"))
+	static void NotifyInteractionDataChanged(AActor* Actor);
+
+	// Query inputs and output, driven by the local player's UInteractionQuerySubsystem
+	void GatherCandidates(TArray<AActor*>& OutCandidates) const;
+	float ScoreCandidate(const AActor* Actor) const;
+	bool RequiresLineOfSight() const { return bRequireLineOfSight; }
+	FVector GetLineOfSightOrigin() const;
+	void ApplyQueryResult(AActor* NewBest, TConstArrayView<AActor*> Visible);
+
 	// Delegates
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractableFound, AActor*, Actor);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractableLost, AActor*, Actor);
@@ -143,10 +181,14 @@ private:
 	AActor* CurrentInteractionTarget;
 	FInteractionData CurrentInteractionData;
 
-	void FindInteractables();
-	AActor* FindBestInteractable();
-	bool IsActorInInteractionCone(AActor* Actor) const;
-	bool HasLineOfSightToActor(AActor* Actor) const;
+	mutable TMap<TWeakObjectPtr<AActor>, FInteractionData> InteractionDataCache;
+	FDelegateHandle DataChangedHandle;
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractionDataChanged, AActor*);
+	static FOnInteractionDataChanged& OnInteractionDataChanged();
+
+	void HandleInteractionDataChanged(AActor* Actor);
+	bool IsActorInInteractionCone(const AActor* Actor) const;
 	void CompleteInteraction();
 	void UpdateInteractionProgress();
 };
\ No newline at end of file
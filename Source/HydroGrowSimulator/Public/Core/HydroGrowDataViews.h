@@ -0,0 +1,187 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/HydroGrowTypes.h"
+#include "HydroGrowDataViews.generated.h"
+
+/**
+ * Hot fields of a plant species row, copied out of the data table when it loads so growth code
+ * and UI polling read plain values without touching FText or soft object pointers.
+ */
+USTRUCT(BlueprintType)
+struct FPlantSpeciesStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	EPlantType PlantType;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	float GrowthTimeInDays;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	FVector2D OptimalPHRange;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	FVector2D OptimalECRange;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	FVector2D OptimalTemperatureRange;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	float OptimalHumidity;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	float LightHoursRequired;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	int32 BaseYield;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	int32 MarketValue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	int32 SeedCost;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	int32 UnlockLevel;
+
+	FPlantSpeciesStats()
+		: FPlantSpeciesStats(FPlantSpeciesData())
+	{
+	}
+
+	explicit FPlantSpeciesStats(const FPlantSpeciesData& Row)
+	{
+		PlantType = Row.PlantType;
+		GrowthTimeInDays = Row.GrowthTimeInDays;
+		OptimalPHRange = Row.OptimalPHRange;
+		OptimalECRange = Row.OptimalECRange;
+		OptimalTemperatureRange = Row.OptimalTemperatureRange;
+		OptimalHumidity = Row.OptimalHumidity;
+		LightHoursRequired = Row.LightHoursRequired;
+		BaseYield = Row.BaseYield;
+		MarketValue = Row.MarketValue;
+		SeedCost = Row.SeedCost;
+		UnlockLevel = Row.UnlockLevel;
+	}
+};
+
+// Hot fields of an equipment row; see FPlantSpeciesStats
+USTRUCT(BlueprintType)
+struct FEquipmentStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+	EEquipmentType EquipmentType;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+	float PowerConsumption;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+	float Effectiveness;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+	int32 PurchaseCost;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+	int32 MaintenanceCost;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+	int32 UnlockLevel;
+
+	FEquipmentStats()
+		: FEquipmentStats(FEquipmentData())
+	{
+	}
+
+	explicit FEquipmentStats(const FEquipmentData& Row)
+	{
+		EquipmentType = Row.EquipmentType;
+		PowerConsumption = Row.PowerConsumption;
+		Effectiveness = Row.Effectiveness;
+		PurchaseCost = Row.PurchaseCost;
+		MaintenanceCost = Row.MaintenanceCost;
+		UnlockLevel = Row.UnlockLevel;
+	}
+};
+
+/**
+ * Read-only reference to a compiled plant species row, resolved through the game instance.
+ * Handles made before a table reload are looked up again by ID.
+ */
+USTRUCT(BlueprintType)
+struct FPlantSpeciesHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Plant")
+	FName SpeciesID;
+
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+};
+
+// Read-only reference to a compiled equipment row; see FPlantSpeciesHandle
+USTRUCT(BlueprintType)
+struct FEquipmentHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+	FName EquipmentID;
+
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+};
+
+/**
+ * Data table rows split into a contiguous array of hot stats and pointers to the full rows, indexed
+ * by row name. Generation changes on every rebuild so stale handle indices are never trusted.
+ */
+template<typename RowType, typename StatsType>
+class TCompiledDataTable
+{
+public:
+	void Build(const UDataTable* Table)
+	{
+		Stats.Reset();
+		Rows.Reset();
+		IndexByID.Reset();
+		Generation++;
+
+		if (!Table)
+		{
+			return;
+		}
+
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			const RowType* TypedRow = reinterpret_cast<const RowType*>(Row.Value);
+			IndexByID.Add(Row.Key, Rows.Add(TypedRow));
+			Stats.Emplace(*TypedRow);
+		}
+	}
+
+	int32 Find(FName ID) const
+	{
+		const int32* Index = IndexByID.Find(ID);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	int32 Resolve(FName ID, int32 Index, uint32 HandleGeneration) const
+	{
+		return HandleGeneration == Generation ? Index : Find(ID);
+	}
+
+	const StatsType* GetStats(int32 Index) const { return Stats.IsValidIndex(Index) ? &Stats[Index] : nullptr; }
+	const RowType* GetRow(int32 Index) const { return Rows.IsValidIndex(Index) ? Rows[Index] : nullptr; }
+	uint32 GetGeneration() const { return Generation; }
+
+private:
+	TArray<StatsType> Stats;
+	TArray<const RowType*> Rows;
+	TMap<FName, int32> IndexByID;
+	uint32 Generation = 0;
+};
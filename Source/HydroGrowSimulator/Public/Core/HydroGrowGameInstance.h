@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Engine/GameInstance.h"
 #include "HydroGrowTypes.h"
+#include "Core/UnlockCatalog.h"
+#include "Core/HydroGrowDataViews.h"
 #include "HydroGrowGameInstance.generated.h"
 
 class UDataTable;
@@ -17,12 +19,45 @@ public:
 	UHydroGrowGameInstance();
 
 	virtual void Init() override;
+	virtual void Shutdown() override;
 
-	UFUNCTION(BlueprintCallable, Category = "Data")
+	UFUNCTION(BlueprintCallable, Category = "Data", meta = (DeprecatedFunction, DeprecationMessage = "Copies the whole row; use FindPlantSpecies and GetPlantStats"))
 	FPlantSpeciesData GetPlantDataCopy(FName PlantID) const;
 
-	UFUNCTION(BlueprintCallable, Category = "Data")
+	UFUNCTION(BlueprintCallable, Category = "Data", meta = (DeprecatedFunction, DeprecationMessage = "Copies the whole row; use FindEquipment and GetEquipmentStats"))
 	FEquipmentData GetEquipmentDataCopy(FName EquipmentID) const;
+
+	// Views of the compiled tables; hot fields come from a POD block, text only when asked for
+	UFUNCTION(BlueprintPure, Category = "Data")
+	FPlantSpeciesHandle FindPlantSpecies(FName PlantID) const;
+
+	UFUNCTION(BlueprintPure, Category = "Data")
+	const FPlantSpeciesStats& GetPlantStats(const FPlantSpeciesHandle& Species) const;
+
+	UFUNCTION(BlueprintPure, Category = "Data")
+	FText GetPlantDisplayName(const FPlantSpeciesHandle& Species) const;
+
+	UFUNCTION(BlueprintPure, Category = "Data")
+	FText GetPlantDescription(const FPlantSpeciesHandle& Species) const;
+
+	UFUNCTION(BlueprintPure, Category = "Data")
+	FEquipmentHandle FindEquipment(FName EquipmentID) const;
+
+	UFUNCTION(BlueprintPure, Category = "Data")
+	const FEquipmentStats& GetEquipmentStats(const FEquipmentHandle& Equipment) const;
+
+	UFUNCTION(BlueprintPure, Category = "Data")
+	FText GetEquipmentDisplayName(const FEquipmentHandle& Equipment) const;
+
+	UFUNCTION(BlueprintPure, Category = "Data")
+	FText GetEquipmentDescription(const FEquipmentHandle& Equipment) const;
+
+	// Null when the handle no longer names a row
+	const FPlantSpeciesStats* FindPlantStats(const FPlantSpeciesHandle& Species) const;
+	const FPlantSpeciesData* GetPlantRow(const FPlantSpeciesHandle& Species) const;
+	const FEquipmentStats* FindEquipmentStats(const FEquipmentHandle& Equipment) const;
+	const FEquipmentData* GetEquipmentRow(const FEquipmentHandle& Equipment) const;
+	bool IsCurrent(const FPlantSpeciesHandle& Species) const { return Species.Generation == PlantTable.GetGeneration(); }
 	
 	// Non-Blueprint accessible versions that return pointers (for internal C++ use)
 	const FPlantSpeciesData* GetPlantData(FName PlantID) const;
@@ -34,6 +69,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Data")
 	TArray<FName> GetUnlockedEquipment(int32 PlayerLevel) const;
 
+	// Allocation-free versions for C++ callers; views stay valid until the table is reloaded
+	TConstArrayView<FName> GetUnlockedPlantIDs(int32 PlayerLevel) const { return PlantCatalog.GetUnlocked(PlayerLevel); }
+	TConstArrayView<FName> GetUnlockedEquipmentIDs(int32 PlayerLevel) const { return EquipmentCatalog.GetUnlocked(PlayerLevel); }
+
 	UFUNCTION(BlueprintCallable, Category = "Save System")
 	bool SaveGameData();
 
@@ -72,6 +111,16 @@ protected:
 	int32 GraphicsQualityLevel;
 
 private:
+	void RebuildPlantCatalog();
+	void RebuildEquipmentCatalog();
+
+	FUnlockCatalog PlantCatalog;
+	FUnlockCatalog EquipmentCatalog;
+	TCompiledDataTable<FPlantSpeciesData, FPlantSpeciesStats> PlantTable;
+	TCompiledDataTable<FEquipmentData, FEquipmentStats> EquipmentTable;
+	FDelegateHandle PlantTableChangedHandle;
+	FDelegateHandle EquipmentTableChangedHandle;
+
 	void InitializeDefaultSettings();
 	void LoadSettings();
 	void SaveSettings();
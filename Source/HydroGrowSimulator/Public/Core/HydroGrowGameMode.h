@@ -8,6 +8,7 @@
 class UHydroGrowGameInstance;
 class AHydroGrowPlayerController;
 class UTimeManager;
+struct FSimulationStepContext;
 
 UCLASS()
 class HYDROGROWSIMULATOR_API AHydroGrowGameMode : public AGameMode
@@ -19,7 +20,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 	// Spawn system overrides
 	virtual AActor* ChoosePlayerStart_Implementation(AController* Player) override;
@@ -103,8 +104,13 @@ private:
 	UPROPERTY()
 	UTimeManager* TimeManager;
 
+	FDelegateHandle SimulationStepHandle;
+
+	// Fractional credits carried between steps so small steps still regenerate
+	float PendingEnergyCredits;
+
 	void InitializeNewGame();
-	void UpdateEnergyCredits(float DeltaTime);
+	void UpdateEnergyCredits(const FSimulationStepContext& Step);
 
 public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLevelUp, int32, NewLevel);
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "HydroGrowInventory.generated.h"
+
+struct FInventoryList;
+
+/**
+ * A single inventory stack: the payload shared by the replicated inventory and the save game.
+ */
+USTRUCT(BlueprintType)
+struct HYDROGROWSIMULATOR_API FInventoryItemData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+	FName ItemID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+	int32 Quantity;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+	FString ItemType;
+
+	FInventoryItemData()
+	{
+		ItemID = NAME_None;
+		Quantity = 0;
+		ItemType = TEXT("Unknown");
+	}
+
+	FInventoryItemData(FName InItemID, int32 InQuantity, const FString& InItemType)
+	{
+		ItemID = InItemID;
+		Quantity = InQuantity;
+		ItemType = InItemType;
+	}
+};
+
+/**
+ * Fast array entry wrapping one stack. Only the replication bookkeeping lives here.
+ */
+USTRUCT(BlueprintType)
+struct HYDROGROWSIMULATOR_API FInventoryEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+	FInventoryItemData Stack;
+
+	FInventoryEntry()
+	{
+	}
+
+	FInventoryEntry(FName InItemID, int32 InQuantity, const FString& InItemType)
+		: Stack(InItemID, InQuantity, InItemType)
+	{
+	}
+
+	// Fast array callbacks (client side)
+	void PreReplicatedRemove(const FInventoryList& InArraySerializer);
+	void PostReplicatedAdd(const FInventoryList& InArraySerializer);
+};
+
+/**
+ * Stacked inventory keyed by item ID. Replicates per-stack deltas through the fast array
+ * serializer and keeps a lookup index so count/contains queries are O(1).
+ */
+USTRUCT(BlueprintType)
+struct HYDROGROWSIMULATOR_API FInventoryList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FInventoryList()
+	{
+		bIndexDirty = false;
+	}
+
+	const TArray<FInventoryEntry>& GetItems() const { return Items; }
+	int32 Num() const { return Items.Num(); }
+
+	bool Contains(FName ItemID) const { return FindStackIndex(ItemID) != INDEX_NONE; }
+	int32 GetQuantity(FName ItemID) const;
+
+	// Returns the new stack total, or 0 if nothing was added
+	int32 AddQuantity(FName ItemID, int32 Quantity, const FString& ItemType = TEXT("Unknown"));
+
+	// Removes the whole amount or nothing. Empty stacks are dropped.
+	bool RemoveQuantity(FName ItemID, int32 Quantity);
+
+	void Reset();
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FInventoryEntry, FInventoryList>(Items, DeltaParms, *this);
+	}
+
+private:
+	friend struct FInventoryEntry;
+
+	UPROPERTY()
+	TArray<FInventoryEntry> Items;
+
+	// ItemID -> index into Items. Not serialized; rebuilt lazily when replication reorders the array.
+	mutable TMap<FName, int32> StackIndex;
+	mutable bool bIndexDirty;
+
+	int32 FindStackIndex(FName ItemID) const;
+	void RebuildIndex() const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventoryList> : public TStructOpsTypeTraitsBase2<FInventoryList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
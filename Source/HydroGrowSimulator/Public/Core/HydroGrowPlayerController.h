@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
 #include "InputActionValue.h"
+#include "Network/HydroGrowNetworkTypes.h"
 #include "HydroGrowPlayerController.generated.h"
 
 class UInputMappingContext;
@@ -44,6 +45,45 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UI")
 	void OpenInventoryPanel();
 
+	// Server: the player's ID string for permissions and the journal, built once rather than per action
+	const FString& GetPlayerID();
+
+	// Client: applies a container action locally and sends it to the server under a new prediction key
+	void SendContainerAction(AHydroponicsContainer* Container, FContainerActionRequest Request);
+
+	// Routed through the controller because clients cannot call server RPCs on containers they do not own.
+	// A container that no longer resolves on the server is answered with a rejection.
+	UFUNCTION(Server, Reliable)
+	void Server_ContainerAction(AHydroponicsContainer* Container, const FContainerActionRequest& Request);
+	void Server_ContainerAction_Implementation(AHydroponicsContainer* Container, const FContainerActionRequest& Request);
+
+	// The server refused a predicted action; accepted ones are acknowledged by the container's replicated state
+	UFUNCTION(Client, Reliable)
+	void Client_RejectContainerAction(AHydroponicsContainer* Container, int32 PredictionKey);
+	void Client_RejectContainerAction_Implementation(AHydroponicsContainer* Container, int32 PredictionKey);
+
+	// Plant actions, routed here for the same reason; the server records this player as acting on the plant.
+	// A plant may already be gone by the time the RPC arrives, so a null plant is ignored rather than rejected.
+	UFUNCTION(Server, Reliable)
+	void Server_HarvestPlant(APlantActor* Plant);
+	void Server_HarvestPlant_Implementation(APlantActor* Plant);
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	void Server_WaterPlant(APlantActor* Plant, float WaterAmount);
+	bool Server_WaterPlant_Validate(APlantActor* Plant, float WaterAmount);
+	void Server_WaterPlant_Implementation(APlantActor* Plant, float WaterAmount);
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	void Server_ApplyPlantNutrients(APlantActor* Plant, const FNutrientLevels& Nutrients);
+	bool Server_ApplyPlantNutrients_Validate(APlantActor* Plant, const FNutrientLevels& Nutrients);
+	void Server_ApplyPlantNutrients_Implementation(APlantActor* Plant, const FNutrientLevels& Nutrients);
+
+	// Client: this connection's copy of a container no longer matches the server's digest
+	UFUNCTION(Server, Unreliable, WithValidation)
+	void Server_ReportDivergence(AHydroponicsContainer* Container, int32 FirstMismatchField);
+	bool Server_ReportDivergence_Validate(AHydroponicsContainer* Container, int32 FirstMismatchField);
+	void Server_ReportDivergence_Implementation(AHydroponicsContainer* Container, int32 FirstMismatchField);
+
 protected:
 	// Input Actions
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
@@ -106,6 +146,11 @@ private:
 	float CurrentCameraDistance;
 	FRotator CameraRotation;
 
+	// Last prediction key handed out by SendContainerAction
+	int32 LastPredictionKey;
+
+	FString CachedPlayerID;
+
 	void UpdateCameraPosition();
 	AActor* GetActorUnderCursor() const;
 
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/SaveGame.h"
 #include "Core/HydroGrowTypes.h"
+#include "Core/HydroGrowInventory.h"
 #include "Systems/TimeManager.h"
 #include "HydroGrowSaveGame.generated.h"
 
@@ -11,6 +12,10 @@ struct FPlantSaveData
 {
 	GENERATED_BODY()
 
+	// APlantActor::GetSimulationID, restored before BeginPlay so journal targets and hashes carry over
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Plant Save Data")
+	int32 SimulationID;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Plant Save Data")
 	FName PlantSpeciesID;
 
@@ -37,6 +42,7 @@ struct FPlantSaveData
 
 	FPlantSaveData()
 	{
+		SimulationID = 0;
 		PlantSpeciesID = NAME_None;
 		GrowthStage = EPlantGrowthStage::Seed;
 		GrowthProgress = 0.0f;
@@ -53,6 +59,10 @@ struct FContainerSaveData
 {
 	GENERATED_BODY()
 
+	// AHydroponicsContainer::GetSimulationID, restored before BeginPlay so random streams carry over
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Save Data")
+	int32 SimulationID;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Save Data")
 	EContainerType ContainerType;
 
@@ -76,6 +86,7 @@ struct FContainerSaveData
 
 	FContainerSaveData()
 	{
+		SimulationID = 0;
 		ContainerType = EContainerType::DWC;
 		WorldLocation = FVector::ZeroVector;
 		WorldRotation = FRotator::ZeroRotator;
@@ -83,35 +94,6 @@ struct FContainerSaveData
 	}
 };
 
-USTRUCT(BlueprintType)
-struct FInventoryItemData
-{
-	GENERATED_BODY()
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
-	FName ItemID;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
-	int32 Quantity;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
-	FString ItemType;
-
-	FInventoryItemData()
-	{
-		ItemID = NAME_None;
-		Quantity = 0;
-		ItemType = TEXT("Unknown");
-	}
-
-	FInventoryItemData(FName InItemID, int32 InQuantity, const FString& InItemType)
-	{
-		ItemID = InItemID;
-		Quantity = InQuantity;
-		ItemType = InItemType;
-	}
-};
-
 USTRUCT(BlueprintType)
 struct FSkillTreeSaveData
 {
@@ -175,8 +157,9 @@ public:
 	int32 EnergyCredits;
 
 	// Game State
+	// Game clock in FGameDateTime ticks (see UTimeManager::GetGameTicks)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game State")
-	FGameDateTime GameTime;
+	int64 GameTicks;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game State")
 	EGameTimeMode TimeMode;
@@ -196,7 +179,7 @@ public:
 
 	// Inventory and Items
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Inventory")
-	TArray<FInventoryItemData> Inventory;
+	TArray<FInventoryItemData> InventoryStacks;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Inventory")
 	TMap<FName, int32> SeedInventory;
@@ -246,6 +229,8 @@ public:
 	int32 UserIndex;
 
 public:
+	virtual void Serialize(FArchive& Ar) override;
+
 	UFUNCTION(BlueprintCallable, Category = "Save System")
 	void InitializeNewSave();
 
@@ -255,6 +240,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Save System")
 	void UpdatePlayTime(float AdditionalHours);
 
+	UFUNCTION(BlueprintPure, Category = "Game State")
+	FGameDateTime GetGameTime() const { return FGameDateTime::FromTicks(GameTicks); }
+
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void AddInventoryItem(FName ItemID, int32 Quantity, const FString& ItemType);
 
@@ -283,5 +271,18 @@ public:
 	bool IsAchievementUnlocked(const FString& AchievementID) const;
 
 private:
-	static constexpr int32 CURRENT_SAVE_VERSION = 1;
+	static constexpr int32 CURRENT_SAVE_VERSION = 3;
+
+	// Version 1 inventory (flat item list), converted to InventoryStacks on load
+	UPROPERTY()
+	TArray<FInventoryItemData> Inventory_DEPRECATED;
+
+	// Version 1-2 calendar clock, converted to GameTicks on load
+	UPROPERTY()
+	FGameDateTime GameTime_DEPRECATED;
+
+	// Converts data loaded from an older SaveVersion to the current layout
+	void UpgradeSaveData();
+
+	FInventoryItemData* FindInventoryStack(FName ItemID);
 };
\ No newline at end of file
@@ -300,4 +300,4 @@ struct FGameplayStats
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlantGrowthStageChanged, EPlantGrowthStage, NewStage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlantHarvested, int32, Yield);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEnvironmentalChange, FString, Parameter, float, NewValue);
\ No newline at end of file
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEnvironmentalChange, FName, Parameter, float, NewValue);
\ No newline at end of file
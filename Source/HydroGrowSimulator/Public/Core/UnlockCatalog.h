@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+
+/**
+ * Row names of one data table ordered by UnlockLevel (ties keep table order), with the end of
+ * each level's prefix precomputed. Everything unlocked at a level is then a view of the first
+ * N names, with no row lookups or allocation per query.
+ */
+class HYDROGROWSIMULATOR_API FUnlockCatalog
+{
+public:
+	// GetUnlockLevel receives each row's raw memory, as stored in the table's row map
+	void Build(const UDataTable* Table, TFunctionRef<int32(const uint8* Row)> GetUnlockLevel);
+	void Reset();
+
+	TConstArrayView<FName> GetUnlocked(int32 PlayerLevel) const;
+	TConstArrayView<FName> GetAll() const { return RowNames; }
+
+private:
+	TArray<FName> RowNames;
+
+	// LevelEnds[i] is the number of rows unlocked at level FirstLevel + i
+	TArray<int32> LevelEnds;
+	int32 FirstLevel = 0;
+};
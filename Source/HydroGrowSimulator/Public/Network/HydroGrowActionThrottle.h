@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Network/HydroGrowNetworkTypes.h"
+#include "HydroGrowActionThrottle.generated.h"
+
+class AHydroGrowPlayerController;
+class AHydroponicsContainer;
+
+USTRUCT(BlueprintType)
+struct FActionThrottleStats
+{
+	GENERATED_BODY()
+
+	// Requests the container accepted
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Network")
+	int32 Applied;
+
+	// Requests folded into a later update of the same setting
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Network")
+	int32 Coalesced;
+
+	// Requests refused because the player ran out of tokens
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Network")
+	int32 Dropped;
+
+	FActionThrottleStats()
+	{
+		Applied = 0;
+		Coalesced = 0;
+		Dropped = 0;
+	}
+};
+
+/**
+ * Server-side gate for container actions sent by clients.
+ *
+ * Absolute settings (pH, EC) are coalesced per player while they repeat: the first request applies
+ * immediately and opens a window; further requests for the same setting on the same container only
+ * replace the pending value, which is applied once when the window closes. Any other request from
+ * the player applies the pending value first, so actions always reach the container in the order
+ * they were sent. A held slider therefore costs one update, one OnContainerInteraction broadcast
+ * and one log line per window instead of one per frame.
+ *
+ * Every applied update spends a token from the player's bucket; a player out of tokens has the
+ * request rejected, which rolls back their prediction.
+ *
+ * Console: HydroGrow.Net.ThrottleStats
+ */
+UCLASS(Config = Game)
+class HYDROGROWSIMULATOR_API UHydroGrowActionThrottle : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UHydroGrowActionThrottle();
+
+	virtual void Deinitialize() override;
+
+	// Applies, defers or rejects a request; rejections are sent to the controller's client
+	void SubmitAction(AHydroGrowPlayerController* Controller, AHydroponicsContainer* Container, const FContainerActionRequest& Request, int32 PlayerId);
+
+	UFUNCTION(BlueprintPure, Category = "Network")
+	const FActionThrottleStats& GetStats() const { return Stats; }
+
+	static UHydroGrowActionThrottle* Get(const UObject* WorldContextObject);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Seconds during which repeated adjustments of one setting collapse into one update
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Network")
+	float CoalesceWindow;
+
+	// Sustained applied actions per second per player
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Network")
+	float TokensPerSecond;
+
+	// Actions a player may apply back to back before the rate limit kicks in
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Network")
+	float TokenBurst;
+
+private:
+	// A player's current run of one setting on one container
+	struct FCoalesceWindow
+	{
+		TWeakObjectPtr<AHydroponicsContainer> Container;
+		int32 PlayerId = INDEX_NONE;
+		double EndTime = 0.0;
+
+		// Latest request of the run, and every prediction key waiting on it (none once applied)
+		FContainerActionRequest Pending;
+		TArray<int32> WaitingKeys;
+	};
+
+	struct FTokenBucket
+	{
+		float Tokens = 0.0f;
+		double LastRefillTime = 0.0;
+	};
+
+	static bool IsCoalescable(EContainerAction Action);
+
+	bool TryConsumeToken(AHydroGrowPlayerController* Controller, double Now);
+	void ApplyAction(AHydroGrowPlayerController* Controller, AHydroponicsContainer* Container, const FContainerActionRequest& Request, int32 PlayerId, TConstArrayView<int32> PredictionKeys);
+	bool ApplyPending(AHydroGrowPlayerController* Controller, FCoalesceWindow& Window, double Now);
+	void FlushWindows();
+	void ScheduleFlush();
+
+	TMap<TWeakObjectPtr<AHydroGrowPlayerController>, FCoalesceWindow> Windows;
+	TMap<TWeakObjectPtr<AHydroGrowPlayerController>, FTokenBucket> Buckets;
+	FTimerHandle FlushTimer;
+	FActionThrottleStats Stats;
+};
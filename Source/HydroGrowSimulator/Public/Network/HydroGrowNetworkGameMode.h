@@ -16,6 +16,9 @@ class HYDROGROWSIMULATOR_API AHydroGrowNetworkGameMode : public AHydroGrowGameMo
 public:
 	AHydroGrowNetworkGameMode();
 
+	// The "<PlayerId>_<PlayerName>" ID used for ownership and permissions; empty without a player state
+	static FString MakePlayerID(const APlayerState* PlayerState);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void PostLogin(APlayerController* NewPlayer) override;
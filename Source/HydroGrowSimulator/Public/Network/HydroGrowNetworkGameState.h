@@ -17,6 +17,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:
@@ -30,7 +31,14 @@ public:
 	const TArray<FNetworkActionLog>& GetActionHistory() const { return ActionHistory; }
 
 	UFUNCTION(BlueprintPure, Category = "Network State")
-	FGameDateTime GetSharedGameTime() const { return SharedGameTime; }
+	FGameDateTime GetSharedGameTime() const { return FGameDateTime::FromTicks(GetSharedGameTicks()); }
+
+	// The shared clock now, advanced from its last anchor on the synchronized server time
+	UFUNCTION(BlueprintPure, Category = "Network State")
+	int64 GetSharedGameTicks() const;
+
+	UFUNCTION(BlueprintPure, Category = "Network State")
+	float GetSharedTimeScale() const { return SharedTimeScale; }
 
 	UFUNCTION(BlueprintPure, Category = "Network State")
 	EGameTimeMode GetSharedTimeMode() const { return SharedTimeMode; }
@@ -47,8 +55,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Network State")
 	void UpdateSharedResources(int32 Coins, int32 Research, int32 Energy);
 
+	// Re-anchor the shared clock at NewGameTicks, advancing at NewTimeScale game seconds per second
 	UFUNCTION(BlueprintCallable, Category = "Network State")
-	void UpdateSharedTime(const FGameDateTime& NewTime, EGameTimeMode NewMode);
+	void UpdateSharedTime(int64 NewGameTicks, EGameTimeMode NewMode, float NewTimeScale);
 
 	UFUNCTION(BlueprintCallable, Category = "Network State")
 	void AddChatMessage(const FNetworkChatMessage& Message);
@@ -70,12 +79,25 @@ protected:
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Shared State")
 	TArray<FNetworkActionLog> ActionHistory;
 
+	// Game clock in FGameDateTime ticks at SharedTimeAnchorSeconds; the calendar view is derived on demand.
+	// Only replicated when the time mode changes or the server clock drifts from the extrapolation.
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Shared Time")
-	FGameDateTime SharedGameTime;
+	int64 SharedGameTicks;
 
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Shared Time")
 	EGameTimeMode SharedTimeMode;
 
+	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Shared Time")
+	float SharedTimeScale;
+
+	// Server world time SharedGameTicks was taken at
+	UPROPERTY(ReplicatedUsing = OnRep_SharedTime)
+	double SharedTimeAnchorSeconds;
+
+	// Game seconds the server's UTimeManager may move away from the shared clock before it is re-anchored
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Shared Time")
+	float SharedTimeMaxDriftSeconds;
+
 	// Shared resources (everyone contributes to and benefits from)
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Shared Resources")
 	int32 SharedCoins;
@@ -100,6 +122,9 @@ protected:
 	int32 MaxPlayers;
 
 private:
+	// Server: follow UTimeManager's mode changes, skips and slowdowns
+	void SyncSharedTime();
+
 	// Replication events
 	UFUNCTION()
 	void OnRep_ConnectedPlayers();
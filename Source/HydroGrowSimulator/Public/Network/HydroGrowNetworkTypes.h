@@ -38,6 +38,80 @@ enum class EContainerPermission : uint8
 	OperateEquipment	UMETA(DisplayName = "Operate Equipment")
 };
 
+// Container commands a client can request (and predict) through its player controller
+UENUM(BlueprintType)
+enum class EContainerAction : uint8
+{
+	PlantSeed			UMETA(DisplayName = "Plant Seed"),
+	RemovePlant			UMETA(DisplayName = "Remove Plant"),
+	SetPHLevel			UMETA(DisplayName = "Set pH Level"),
+	SetECLevel			UMETA(DisplayName = "Set EC Level"),
+	AddNutrients		UMETA(DisplayName = "Add Nutrients"),
+	StartWaterPump		UMETA(DisplayName = "Start Water Pump"),
+	StopWaterPump		UMETA(DisplayName = "Stop Water Pump")
+};
+
+USTRUCT(BlueprintType)
+struct FContainerActionRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Action")
+	EContainerAction Action;
+
+	// Chosen by the requesting client; acknowledged through the container or echoed back on rejection
+	UPROPERTY()
+	int32 PredictionKey;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Action")
+	FName PlantSpeciesID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Action")
+	int32 SlotIndex;
+
+	// pH or EC for the level actions
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Action")
+	float Value;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Action")
+	FNutrientLevels Nutrients;
+
+	FContainerActionRequest()
+	{
+		Action = EContainerAction::SetPHLevel;
+		PredictionKey = 0;
+		PlantSpeciesID = NAME_None;
+		SlotIndex = -1;
+		Value = 0.0f;
+	}
+
+	explicit FContainerActionRequest(EContainerAction InAction)
+		: FContainerActionRequest()
+	{
+		Action = InAction;
+	}
+};
+
+// Highest prediction key of one player that a container's replicated state already includes
+USTRUCT()
+struct FPredictionAck
+{
+	GENERATED_BODY()
+
+	// APlayerState::GetPlayerId of the requesting player
+	UPROPERTY()
+	int32 PlayerId;
+
+	UPROPERTY()
+	int32 PredictionKey;
+
+	FPredictionAck()
+	{
+		PlayerId = INDEX_NONE;
+		PredictionKey = 0;
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FPlayerPermissions
 {
@@ -221,6 +295,44 @@ struct FNetworkActionLog
 	}
 };
 
+// One-shot plant effects with no replicated state behind them
+UENUM()
+enum class EPlantCosmeticEvent : uint8
+{
+	Harvested
+};
+
+USTRUCT()
+struct FPlantCosmeticEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	EPlantCosmeticEvent Type;
+
+	// Event payload, e.g. the yield for Harvested
+	UPROPERTY()
+	int32 Value;
+
+	// Player state id of the instigator, INDEX_NONE for the simulation itself; clients resolve the name
+	UPROPERTY()
+	int32 PlayerId;
+
+	FPlantCosmeticEvent()
+	{
+		Type = EPlantCosmeticEvent::Harvested;
+		Value = 0;
+		PlayerId = INDEX_NONE;
+	}
+
+	FPlantCosmeticEvent(EPlantCosmeticEvent InType, int32 InValue, int32 InPlayerId)
+	{
+		Type = InType;
+		Value = InValue;
+		PlayerId = InPlayerId;
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FNetworkChatMessage
 {
@@ -255,6 +367,75 @@ struct FNetworkChatMessage
 	}
 };
 
+/**
+ * Compact digest of an actor's authoritative simulation state. The server rebuilds it only when
+ * the actor's state changed and replicates it with the state itself; clients rebuild it from
+ * their local copy to detect silent divergence. Combined covers every field bitwise, and four
+ * bits per field (up to MaxFields) are kept so a mismatch can usually name the first differing field.
+ */
+USTRUCT()
+struct FStateDigest
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxFields = 16;
+
+	UPROPERTY()
+	uint32 Combined;
+
+	UPROPERTY()
+	uint64 FieldHashes;
+
+	FStateDigest()
+	{
+		Reset();
+	}
+
+	void Reset()
+	{
+		Combined = 0;
+		FieldHashes = 0;
+		NumFields = 0;
+	}
+
+	// Fields must be added in the same order on server and client
+	void AddField(float Value) { AddField(&Value, sizeof(Value)); }
+	void AddField(int32 Value) { AddField(&Value, sizeof(Value)); }
+
+	bool IsSet() const { return Combined != 0 || FieldHashes != 0; }
+
+	bool operator==(const FStateDigest& Other) const { return Combined == Other.Combined && FieldHashes == Other.FieldHashes; }
+	bool operator!=(const FStateDigest& Other) const { return !(*this == Other); }
+
+	// First field whose hash differs, or MaxFields if only fields beyond the tracked ones differ
+	int32 FindFirstMismatch(const FStateDigest& Other) const
+	{
+		const uint64 Difference = FieldHashes ^ Other.FieldHashes;
+		for (int32 Field = 0; Field < MaxFields; Field++)
+		{
+			if ((Difference >> (Field * 4)) & 0xF)
+			{
+				return Field;
+			}
+		}
+		return MaxFields;
+	}
+
+private:
+	int32 NumFields;
+
+	void AddField(const void* Data, int32 Size)
+	{
+		Combined = FCrc::MemCrc32(Data, Size, Combined);
+		if (NumFields < MaxFields)
+		{
+			const uint64 FieldHash = FCrc::MemCrc32(Data, Size, NumFields) & 0xF;
+			FieldHashes |= FieldHash << (NumFields * 4);
+		}
+		NumFields++;
+	}
+};
+
 // Network functions are now defined using standard UE5 RPC syntax directly in the class headers
 
 // Delegates for multiplayer events
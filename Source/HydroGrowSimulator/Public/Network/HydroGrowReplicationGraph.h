@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "HydroGrowReplicationGraph.generated.h"
+
+class AHydroponicsContainer;
+
+// How a replicated class is routed into the graph
+enum class EHydroGrowRepNodeMapping : uint8
+{
+	NotRouted,					// Handled by a specialised node (player controllers, player states)
+	RelevantAllConnections,		// Game state and other global info actors
+	Spatialize_Static,			// Placed once in the grid; containers and plants do not move
+	Spatialize_Dynamic,			// Re-bucketed every frame (characters)
+};
+
+/**
+ * Per-connection node: the viewer's controller, pawn and view target (from the base class), plus
+ * every container the connection's player owns. For this connection only, owned containers lose
+ * their cull distance and use the graph's owner replication period, so a player's own containers
+ * keep replicating at full rate wherever the player stands. The owned list is refreshed every few
+ * frames from the graph's container list rather than on every gather.
+ */
+UCLASS()
+class HYDROGROWSIMULATOR_API UHydroGrowReplicationGraphNode_OwnedContainers : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	// Replication frames between rebuilds of the owned container list
+	int32 RefreshIntervalFrames = 30;
+
+private:
+	FActorRepListRefView OwnedContainers;
+	uint32 NextRefreshFrame = 0;
+
+	// Containers carrying owner settings on this connection, restored once they change hands
+	TArray<TWeakObjectPtr<AHydroponicsContainer>> BoostedContainers;
+};
+
+/**
+ * Replication graph for large shared gardens.
+ *
+ * Containers and plants are bucketed into a 2D spatial grid, so each connection only considers
+ * actors in the cells around its viewer; game state and info actors sit in one always-relevant
+ * list; player states are rate limited by the engine's frequency limiter node. Each player's own
+ * containers are added by a per-connection node that exempts them from cull distance and replicates
+ * them every OwnedContainerReplicationPeriodFrame frames for their owner.
+ *
+ * Enabled through ReplicationDriverClassName in DefaultEngine.ini.
+ */
+UCLASS(Transient, Config = Engine)
+class HYDROGROWSIMULATOR_API UHydroGrowReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	UHydroGrowReplicationGraph();
+
+	virtual void ResetGameWorldState() override;
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	// Every replicated container in the world, scanned by the per-connection owned container nodes
+	const TArray<TWeakObjectPtr<AHydroponicsContainer>>& GetContainers() const { return Containers; }
+
+	// Switches a container's settings on one connection between owner (no cull distance, owner
+	// replication period) and its class defaults
+	void SetOwnerSettings(UNetReplicationGraphConnection& Connection, AHydroponicsContainer* Container, bool bOwned);
+
+	// Grid cell size in unreal units
+	UPROPERTY(Config)
+	float SpatialCellSize;
+
+	// Offset so the grid covers negative coordinates without growing
+	UPROPERTY(Config)
+	FVector2D SpatialBias;
+
+	// Replication period, in frames, of a container on its owner's connection
+	UPROPERTY(Config)
+	int32 OwnedContainerReplicationPeriodFrame;
+
+	UPROPERTY()
+	UReplicationGraphNode_GridSpatialization2D* GridNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_PlayerStateFrequencyLimiter* PlayerStateNode;
+
+private:
+	EHydroGrowRepNodeMapping GetMappingPolicy(const UClass* Class);
+	void InitClassReplicationInfo(FClassReplicationInfo& Info, const UClass* Class, bool bSpatialize) const;
+
+	TClassMap<EHydroGrowRepNodeMapping> ClassRepNodePolicies;
+	TArray<TWeakObjectPtr<AHydroponicsContainer>> Containers;
+};
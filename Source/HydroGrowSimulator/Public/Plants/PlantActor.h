@@ -3,7 +3,9 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/HydroGrowTypes.h"
+#include "Core/HydroGrowDataViews.h"
 #include "Network/HydroGrowNetworkTypes.h"
+#include "Systems/SignificanceSubsystem.h"
 #include "ProceduralMeshComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "PlantActor.generated.h"
@@ -11,7 +13,112 @@
 class UHydroGrowGameInstance;
 class AHydroponicsContainer;
 class UTimeManager;
+class APlayerState;
+class AHydroGrowPlayerController;
 struct FPlantMeshConfiguration;
+struct FSimulationStepContext;
+
+/**
+ * Plant state as sent to clients: values at ReferenceTicks on the shared game clock plus their
+ * rates, so clients extrapolate progress, age and health themselves and the server only sends a
+ * new anchor when a rate or the stage changes, or when the extrapolation drifts from the
+ * simulation. NetSerialize writes a mask of the optional fields and skips those holding their
+ * implied value: full health, default max health, zero rates and no recorded action.
+ */
+USTRUCT()
+struct FPlantReplicatedState
+{
+	GENERATED_BODY()
+
+	static constexpr float ProgressSteps = MAX_uint16;
+	static constexpr float AgeStepDays = 1.0f / 1440.0f;
+	static constexpr uint16 FullHealth = MAX_uint16;
+	static constexpr uint16 DefaultMaxHealth = 100;
+
+	UPROPERTY()
+	uint8 Stage;
+
+	// GrowthProgress in 1/ProgressSteps
+	UPROPERTY()
+	uint16 Progress;
+
+	// AgeInDays in AgeStepDays
+	UPROPERTY()
+	uint32 Age;
+
+	// Health as a fraction of MaxHealth in 1/FullHealth
+	UPROPERTY()
+	uint16 Health;
+
+	UPROPERTY()
+	uint16 MaxHealth;
+
+	// Progress per game second
+	UPROPERTY()
+	float GrowthRate;
+
+	// Health points per game hour
+	UPROPERTY()
+	float HealthRate;
+
+	// Game clock tick the values above were taken at
+	UPROPERTY()
+	int64 ReferenceTicks;
+
+	// Player state id of the last player to act on the plant; INDEX_NONE if it did not resolve
+	UPROPERTY()
+	int32 ActionPlayerId;
+
+	// Bumped per action so repeated actions by one player still replicate; 0 means none yet
+	UPROPERTY()
+	uint8 ActionSerial;
+
+	FPlantReplicatedState()
+	{
+		Stage = 0;
+		Progress = 0;
+		Age = 0;
+		Health = FullHealth;
+		MaxHealth = DefaultMaxHealth;
+		GrowthRate = 0.0f;
+		HealthRate = 0.0f;
+		ReferenceTicks = 0;
+		ActionPlayerId = INDEX_NONE;
+		ActionSerial = 0;
+	}
+
+	void Pack(EPlantGrowthStage InStage, float InProgress, float InAgeDays, float InHealth, float InMaxHealth,
+		float InGrowthRate, float InHealthRate, int64 InReferenceTicks);
+	void RecordAction(int32 PlayerId);
+
+	// Values at GameTicks, following the simulation's linear growth and clamping
+	void Extrapolate(int64 GameTicks, float& OutProgress, float& OutAgeDays, float& OutHealth) const;
+
+	EPlantGrowthStage GetStage() const { return static_cast<EPlantGrowthStage>(Stage); }
+	float GetProgress() const { return Progress / ProgressSteps; }
+	float GetAgeInDays() const { return Age * AgeStepDays; }
+	float GetMaxHealth() const { return MaxHealth; }
+	float GetHealth() const { return GetMaxHealth() * Health / FullHealth; }
+
+	bool operator==(const FPlantReplicatedState& Other) const
+	{
+		return Stage == Other.Stage && Progress == Other.Progress && Age == Other.Age && Health == Other.Health
+			&& MaxHealth == Other.MaxHealth && GrowthRate == Other.GrowthRate && HealthRate == Other.HealthRate
+			&& ReferenceTicks == Other.ReferenceTicks && ActionPlayerId == Other.ActionPlayerId && ActionSerial == Other.ActionSerial;
+	}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FPlantReplicatedState> : public TStructOpsTypeTraitsBase2<FPlantReplicatedState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
 
 
 UCLASS()
@@ -24,6 +131,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -46,43 +154,39 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Plant")
 	bool CanHarvestPlant() const;
 
+	// On a client the request is sent through InstigatingController, or the only local player's controller
 	UFUNCTION(BlueprintCallable, Category = "Plant")
-	int32 HarvestPlant(const FString& PlayerName = TEXT(""));
+	int32 HarvestPlant(AHydroGrowPlayerController* InstigatingController = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Plant")
 	void UpdateVisualAppearance();
 
+	// Set by USignificanceSubsystem. Away from Near, visual changes wait for ApplyPendingVisualUpdate
+	// and fine steps are deferred for up to MaxDeferredGameSeconds.
+	void SetSignificance(ESignificanceTier Tier, float MaxDeferredGameSeconds);
+	bool HasPendingVisualUpdate() const { return bVisualUpdatePending; }
+	void ApplyPendingVisualUpdate();
+
+	// Simulate any deferred game time now, so the state is current
+	void FlushDeferredSimulation();
+
 	// Apply Ultimate Farming Kit mesh configuration
 	UFUNCTION(BlueprintCallable, Category = "Plant Meshes")
 	void ApplyMeshConfiguration(const FPlantMeshConfiguration& Config);
 
-	// Network functions
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_HarvestPlant(const FString& PlayerName);
-	bool Server_HarvestPlant_Validate(const FString& PlayerName);
-	void Server_HarvestPlant_Implementation(const FString& PlayerName);
-	
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_WaterPlant(float WaterAmount, const FString& PlayerName);
-	bool Server_WaterPlant_Validate(float WaterAmount, const FString& PlayerName);
-	void Server_WaterPlant_Implementation(float WaterAmount, const FString& PlayerName);
-	
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_ApplyNutrients(const FNutrientLevels& Nutrients, const FString& PlayerName);
-	bool Server_ApplyNutrients_Validate(const FNutrientLevels& Nutrients, const FString& PlayerName);
-	void Server_ApplyNutrients_Implementation(const FNutrientLevels& Nutrients, const FString& PlayerName);
+	// Server: player actions, sent by clients through AHydroGrowPlayerController. Instigator is
+	// recorded as the last player to act on the plant.
+	int32 HarvestFor(const APlayerState* Instigator);
+	void WaterPlantFor(float WaterAmount, const APlayerState* Instigator);
+	void ApplyNutrientsFor(const FNutrientLevels& Nutrients, const APlayerState* Instigator);
+
+	// State changes reach clients through rep-notifies; only one-shot cosmetic events are
+	// multicast, queued on the server and sent once per frame
+	void QueueCosmeticEvent(EPlantCosmeticEvent Type, int32 Value, int32 PlayerId);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_PlantGrowthStageChanged(EPlantGrowthStage NewStage);
-	void Multicast_PlantGrowthStageChanged_Implementation(EPlantGrowthStage NewStage);
-	
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_PlantHarvested(int32 Yield, const FString& PlayerName);
-	void Multicast_PlantHarvested_Implementation(int32 Yield, const FString& PlayerName);
-	
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_PlantHealthChanged(float NewHealth);
-	void Multicast_PlantHealthChanged_Implementation(float NewHealth);
+	void Multicast_PlantCosmeticEvents(const TArray<FPlantCosmeticEvent>& Events);
+	void Multicast_PlantCosmeticEvents_Implementation(const TArray<FPlantCosmeticEvent>& Events);
 
 	UFUNCTION(BlueprintPure, Category = "Plant")
 	float GetGrowthPercentage() const;
@@ -96,18 +200,42 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Plant")
 	FName GetPlantSpeciesID() const { return PlantSpeciesID; }
 
-	UFUNCTION(BlueprintPure, Category = "Plant")
+	UFUNCTION(BlueprintPure, Category = "Plant", meta = (DeprecatedFunction, DeprecationMessage = "Copies the whole row; use GetSpecies with the game instance views"))
 	FPlantSpeciesData GetPlantData() const;
 
+	// Handle to this plant's species row, refreshed when the species or the table changes
+	UFUNCTION(BlueprintPure, Category = "Plant")
+	const FPlantSpeciesHandle& GetSpecies() const;
+
+	// Null until the species resolves
+	const FPlantSpeciesStats* GetSpeciesStats() const;
+
 	UFUNCTION(BlueprintPure, Category = "Plant")
 	bool IsAlive() const { return CurrentGrowthStage != EPlantGrowthStage::Dead; }
 
 	UFUNCTION(BlueprintPure, Category = "Plant")
 	float GetDaysOld() const { return AgeInDays; }
 
+	// Bitwise hash of the simulated state, for journal replay comparison
+	uint32 GetSimulationStateHash() const;
+
+	// What clients were last sent (server) or last received (client)
+	const FPlantReplicatedState& GetReplicatedState() const { return ReplicatedState; }
+
+	// Stable identity for the journal and state hashes (0 until registered on the server)
+	UFUNCTION(BlueprintPure, Category = "Plant")
+	int32 GetSimulationID() const { return SimulationID; }
+
+	// Restores a saved ID; only takes effect before BeginPlay (e.g. on a deferred spawn)
+	void SetSimulationID(int32 InSimulationID) { SimulationID = InSimulationID; }
+
 	UFUNCTION(BlueprintCallable, Category = "Plant")
 	void SetEnvironmentalConditions(const FEnvironmentalConditions& Conditions);
 
+	// Sync the nutrient solution the plant sits in (no health bonus, unlike ApplyNutrients)
+	UFUNCTION(BlueprintCallable, Category = "Plant")
+	void SetNutrientLevels(const FNutrientLevels& Nutrients);
+
 protected:
 	// Core Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -137,32 +265,40 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Plant Meshes")
 	bool bUseStaticMeshes;
 
+	// Relative scale change below which visual updates leave the mesh transform alone
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Plant Meshes")
+	float VisualScaleHysteresis;
+
 	// Plant Data
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "Plant Data")
 	FName PlantSpeciesID;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
+	// Plant state; replicated through ReplicatedState, and extrapolated on clients between updates
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
 	EPlantGrowthStage CurrentGrowthStage;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
 	float GrowthProgress;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
 	float AgeInDays;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
 	float HealthPoints;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Plant State")
 	float MaxHealthPoints;
 
 	// Network tracking
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Network")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Network")
 	FString LastActionPlayer;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Network")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Network")
 	FDateTime LastActionTime;
 
+	UPROPERTY(ReplicatedUsing = OnRep_ReplicatedState)
+	FPlantReplicatedState ReplicatedState;
+
 	// Environmental factors
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
 	FEnvironmentalConditions CurrentEnvironment;
@@ -194,26 +330,72 @@ protected:
 	UPROPERTY()
 	UHydroGrowGameInstance* GameInstance;
 
+	mutable FPlantSpeciesHandle Species;
+
+	// Assigned in spawn order by the journal's sequence, so a replay spawns the same IDs
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Plant")
+	int32 SimulationID;
+
 	UPROPERTY()
 	UTimeManager* TimeManager;
 
 	// Replication callbacks
 	UFUNCTION()
-	void OnRep_GrowthStage();
-
-	UFUNCTION()
-	void OnRep_HealthPoints();
-
-	UFUNCTION()
-	void OnRep_GrowthProgress();
+	void OnRep_ReplicatedState();
 
 private:
+	// Fixed-step simulation (server only), driven by UTimeManager
+	void SimulateStep(const FSimulationStepContext& Step);
+	void SimulateCoarseStep(float DeltaTime);
+	void PredictNextEvent(double& InOutSeconds) const;
+	FDelegateHandle SimulationStepHandle;
+	FDelegateHandle PredictNextEventHandle;
+
 	void UpdateGrowthProgress(float DeltaTime);
 	void UpdateGrowthStage();
 	void UpdateHealthPoints(float DeltaTime);
+	float GetGrowthRatePerSecond() const;
+	float GetHealthChangePerHour() const;
+	float GetNextStageThreshold() const;
 	void CalculateGrowthFactors();
 	void UpdateVisualAppearanceInternal();
+	void ApplyVisualAppearance();
 	void CheckForProblems();
+
+	ESignificanceTier SignificanceTier;
+	bool bSignificanceManaged;
+	bool bVisualUpdatePending;
+	float DeferredSimulationSeconds;
+	float MaxDeferredSimulationSeconds;
+
+	// What the mesh components currently show; a negative scale forces the next apply
+	float AppliedVisualScale;
+	EPlantGrowthStage AppliedGrowthStage;
+	bool bAppliedStaticMeshMode;
+
+	// Server: re-anchor ReplicatedState when the growth factor or stage changed, or when clients'
+	// extrapolation would have drifted from the simulated values
+	void PackReplicatedState();
+	void RecordAction(const APlayerState* Instigator);
+	float AnchoredGrowthFactor;
+
+	// Name of the player state with this id, "Unknown" when it has left or was never a player
+	FString ResolvePlayerName(int32 PlayerId) const;
+
+	// Game clock the replicated state is measured on: the shared clock on clients (the state's own
+	// reference time without one), and on the server the time the simulated values are current to
+	int64 GetReplicationClockTicks() const;
+
+	// Client: returns whether the extrapolated values moved
+	bool ExtrapolateReplicatedState();
+	uint8 LastSeenActionSerial;
+
+	// Cosmetic events waiting for this frame's multicast (server only)
+	TArray<FPlantCosmeticEvent> PendingCosmeticEvents;
+	void FlushCosmeticEvents();
+
+	// One bit per condition already reported as poor by CheckForProblems
+	uint8 ReportedProblems;
 	
 	// Static mesh selection helper
 	UStaticMesh* GetMeshForCurrentState() const;
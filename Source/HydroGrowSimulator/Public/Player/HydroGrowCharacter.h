@@ -9,6 +9,7 @@
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/HydroGrowInventory.h"
 #include "HydroGrowCharacter.generated.h"
 
 class UInputMappingContext;
@@ -16,6 +17,7 @@ class UInputAction;
 class AHydroponicsContainer;
 class APlantActor;
 class UInteractionComponent;
+class UHydroGrowSaveGame;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionFound, AActor*, InteractableActor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInteractionLost);
@@ -127,13 +129,10 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Character")
 	bool SpendCurrency(int32 Amount);
 
-	// Interaction system
+	// Interaction system; targets are found by the local player's UInteractionQuerySubsystem
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void FindInteractables();
 
-	UFUNCTION(BlueprintCallable, Category = "Interaction")
-	bool CanInteractWith(AActor* Actor) const;
-
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void InteractWithActor(AActor* Actor);
 
@@ -150,10 +149,11 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Gardening")
 	void InteractWithPlant(APlantActor* Plant);
 
-	// Inventory and tools
+	// Inventory and tools (stacks of item ID + quantity, replicated as per-stack deltas)
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Inventory")
-	TArray<FName> InventoryItems;
+	FInventoryList Inventory;
 
+	// Maximum number of distinct stacks
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
 	int32 MaxInventorySlots;
 
@@ -162,13 +162,21 @@ public:
 	bool HasItem(FName ItemID) const;
 
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
-	bool AddItem(FName ItemID);
+	bool AddItem(FName ItemID, int32 Quantity = 1);
 
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
-	bool RemoveItem(FName ItemID);
+	bool RemoveItem(FName ItemID, int32 Quantity = 1);
 
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	int32 GetItemCount(FName ItemID) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void SaveInventory(UHydroGrowSaveGame* SaveGame) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void LoadInventory(const UHydroGrowSaveGame* SaveGame);
+
+	const FInventoryList& GetInventory() const { return Inventory; }
 	// Delegates
 	UPROPERTY(BlueprintAssignable)
 	FOnInteractionFound OnInteractionFound;
@@ -192,6 +200,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Interaction")
 	AActor* GetCurrentInteractable() const { return CurrentInteractable; }
 
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	bool CanInteractWith(AActor* Actor) const;
+
+	UFUNCTION(BlueprintPure, Category = "Interaction")
+	float GetInteractionRange() const { return InteractionRange; }
+
 	UFUNCTION(BlueprintPure, Category = "Camera")
 	UCameraComponent* GetThirdPersonCameraComponent() const { return ThirdPersonCamera; }
 
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "Tickable.h"
+#include "Engine/World.h"
+#include "InteractionQuerySubsystem.generated.h"
+
+class AHydroGrowCharacter;
+class UInteractionComponent;
+
+/**
+ * The one interaction query per local player.
+ *
+ * Each query picks a single target and hands it to the pawn's UInteractionComponent (whose
+ * found/lost events drive the character's CurrentInteractable), then issues the next batch of
+ * async traces: a view ray from the camera plus line-of-sight rays to candidates in the
+ * component's range and cone. Trace results are read on the following tick, so no trace ever
+ * blocks the game thread.
+ *
+ * Line-of-sight results are cached per actor and only retraced when the actor or the viewer has
+ * moved more than SightRecheckDistance, or the result is older than SightRecheckInterval. At most
+ * MaxSightTracesPerQuery are issued per query, best scoring candidates first; the rest keep their
+ * cached result (or count as hidden until first traced).
+ *
+ * An interactable under the camera ray wins; otherwise the best scoring visible candidate.
+ */
+UCLASS(Config = Game)
+class HYDROGROWSIMULATOR_API UInteractionQuerySubsystem : public ULocalPlayerSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UInteractionQuerySubsystem();
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+
+	// Run a query on the next tick regardless of QueryInterval
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	void RequestQuery() { TimeSinceQuery = TNumericLimits<float>::Max(); }
+
+	UFUNCTION(BlueprintPure, Category = "Interaction")
+	AActor* GetTarget() const { return Target.Get(); }
+
+	// Seconds between queries; 0 queries every frame
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Interaction")
+	float QueryInterval;
+
+	// Line-of-sight traces issued per query
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Interaction")
+	int32 MaxSightTracesPerQuery;
+
+	// Movement of either end, in cm, that invalidates a cached line-of-sight result
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Interaction")
+	float SightRecheckDistance;
+
+	// Seconds after which a cached result is retraced anyway, for obstacles that move
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Interaction")
+	float SightRecheckInterval;
+
+private:
+	struct FSightResult
+	{
+		FVector Origin = FVector::ZeroVector;
+		FVector TargetLocation = FVector::ZeroVector;
+		double Time = 0.0;
+		bool bVisible = false;
+	};
+
+	struct FSightTrace
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FTraceHandle Handle;
+		FSightResult Result;
+	};
+
+	void ConsumeTraces(UWorld* World);
+	void RunQuery(UWorld* World, AHydroGrowCharacter* Character, UInteractionComponent* Interaction);
+	void IssueTraces(UWorld* World, AHydroGrowCharacter* Character, UInteractionComponent* Interaction);
+	bool NeedsSightTrace(AActor* Actor, const FVector& Origin, double Now) const;
+
+	// Issued last tick, read this tick
+	FTraceHandle ViewTrace;
+	TArray<FSightTrace> SightTraces;
+
+	TWeakObjectPtr<AActor> ViewedActor;
+	TMap<TWeakObjectPtr<AActor>, FSightResult> SightCache;
+
+	// Reused every query
+	TArray<AActor*> Candidates;
+	TArray<AActor*> Visible;
+	TArray<TPair<float, AActor*>> TraceQueue;
+
+	TWeakObjectPtr<AActor> Target;
+	float TimeSinceQuery;
+};
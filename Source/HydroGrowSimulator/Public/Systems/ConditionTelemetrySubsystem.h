@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Systems/TelemetrySeries.h"
+#include "ConditionTelemetrySubsystem.generated.h"
+
+class AHydroponicsContainer;
+class UTimeManager;
+struct FSimulationStepContext;
+
+UENUM(BlueprintType)
+enum class ETelemetryChannel : uint8
+{
+	PHLevel,
+	ECLevel,
+	Temperature,
+	OxygenLevel,
+	WaterLevel,
+	Nitrogen,
+	Phosphorus,
+	Potassium
+};
+
+/** One downsampled point of a container history */
+USTRUCT(BlueprintType)
+struct FTelemetryPoint
+{
+	GENERATED_BODY()
+
+	// Start of the bucket, in game hours since the epoch
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Telemetry")
+	float GameHour;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Telemetry")
+	float Min;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Telemetry")
+	float Max;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Telemetry")
+	float Mean;
+
+	// 0 when nothing was recorded in the bucket
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Telemetry")
+	int32 SampleCount;
+
+	FTelemetryPoint()
+	{
+		GameHour = 0.0f;
+		Min = 0.0f;
+		Max = 0.0f;
+		Mean = 0.0f;
+		SampleCount = 0;
+	}
+};
+
+/**
+ * Records container conditions and nutrient levels over game time, for dashboards and graphs.
+ *
+ * Every SampleIntervalHours of game time (checked after each simulation step) all containers are
+ * sampled into a compressed FTelemetrySeries, at a few hundred bytes per container per game day
+ * at hourly sampling. Queries downsample any window into a fixed number of points.
+ *
+ * Console: HydroGrow.Telemetry.Stats
+ */
+UCLASS()
+class HYDROGROWSIMULATOR_API UConditionTelemetrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UConditionTelemetrySubsystem();
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Min/max/mean of a channel over NumPoints equal buckets between two game hours
+	UFUNCTION(BlueprintCallable, Category = "Telemetry")
+	TArray<FTelemetryPoint> QueryHistory(AHydroponicsContainer* Container, ETelemetryChannel Channel, float StartGameHour, float EndGameHour, int32 NumPoints) const;
+
+	// Bytes held by every recorded history
+	UFUNCTION(BlueprintPure, Category = "Telemetry")
+	int64 GetMemoryBytes() const;
+
+	void LogStats() const;
+
+	static UConditionTelemetrySubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Telemetry")
+	float SampleIntervalHours;
+
+	// Retention per container in blocks of FTelemetrySeries::SamplesPerBlock samples
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Telemetry")
+	int32 MaxBlocksPerContainer;
+
+private:
+	void OnSimulationStepComplete(const FSimulationStepContext& Step);
+	void SampleContainers(int64 GameSeconds);
+
+	TMap<TWeakObjectPtr<AHydroponicsContainer>, FTelemetrySeries> Histories;
+	int64 NextSampleTicks;
+
+	UPROPERTY()
+	UTimeManager* TimeManager;
+
+	FDelegateHandle StepCompleteHandle;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Alert bits raised by the chemistry kernel, handled on the game thread after write-back */
+enum class EContainerChemistryAlert : uint8
+{
+	None		= 0,
+	LowWater	= 1 << 0,
+};
+ENUM_CLASS_FLAGS(EContainerChemistryAlert);
+
+/**
+ * Plain-old-data snapshot of one container's solution chemistry. Gathered from the actor on the
+ * game thread, stepped on worker threads and written back, so the kernel never touches UObjects.
+ */
+struct FContainerChemistryState
+{
+	// Inputs
+	int32 PlantCount;
+	bool bPumpRunning;
+
+	// Litres the container holds at a full water level
+	float WaterCapacity;
+
+	// Litres per game hour exchanged with the supply reservoir per unit level difference (0 if not plumbed or pump off)
+	float FlowConductance;
+
+	// Random stream key, stable per container; noise is drawn in the kernel from (key, step)
+	uint32 RandomStream;
+
+	// Solution state (inputs and outputs)
+	float PHLevel;
+	float ECLevel;
+	float OxygenLevel;
+	float WaterLevel;
+	float Nitrogen;
+	float Phosphorus;
+	float Potassium;
+
+	// Outputs
+	EContainerChemistryAlert Alerts;
+
+	FContainerChemistryState()
+		: PlantCount(0)
+		, bPumpRunning(false)
+		, WaterCapacity(0.0f)
+		, FlowConductance(0.0f)
+		, RandomStream(0)
+		, PHLevel(0.0f)
+		, ECLevel(0.0f)
+		, OxygenLevel(0.0f)
+		, WaterLevel(0.0f)
+		, Nitrogen(0.0f)
+		, Phosphorus(0.0f)
+		, Potassium(0.0f)
+		, Alerts(EContainerChemistryAlert::None)
+	{
+	}
+};
+
+namespace ContainerChemistry
+{
+	// Water level below which oxygen drops and an alert is raised
+	constexpr float LowWaterLevel = 0.3f;
+
+	// Water lost per game second (5% per game day)
+	constexpr float EvaporationPerSecond = 0.05f / 86400.0f;
+
+	// Advance one container by DeltaTime game seconds. Closed-form, so any step length is valid. Thread-safe,
+	// and deterministic for a given state and step index.
+	HYDROGROWSIMULATOR_API void Step(FContainerChemistryState& State, float DeltaTime, int64 StepIndex);
+
+	// Game seconds until the next alert at current rates, or a very large value if none is coming
+	HYDROGROWSIMULATOR_API double GetSecondsToNextAlert(const FContainerChemistryState& State);
+}
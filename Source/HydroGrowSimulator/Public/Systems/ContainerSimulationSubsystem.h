@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Systems/ContainerChemistry.h"
+#include "Systems/HydroFlowNetwork.h"
+#include "ContainerSimulationSubsystem.generated.h"
+
+class AHydroponicsContainer;
+class UTimeManager;
+struct FSimulationStepContext;
+
+/**
+ * Steps the solution chemistry of every container in the world (server only).
+ *
+ * Each simulation step gathers all registered containers into one contiguous state buffer,
+ * runs the chemistry kernel across worker threads and writes the results back in a single pass
+ * on the game thread, so large farms scale with core count instead of container count.
+ * Before the kernel runs, water and nutrients are exchanged between containers and their supply
+ * reservoirs by the flow network solver.
+ */
+UCLASS()
+class HYDROGROWSIMULATOR_API UContainerSimulationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UContainerSimulationSubsystem();
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	void RegisterContainer(AHydroponicsContainer* Container);
+	void UnregisterContainer(AHydroponicsContainer* Container);
+
+	// Rebuild the flow network before the next step (a supply reservoir changed)
+	void MarkPlumbingDirty() { bPlumbingDirty = true; }
+
+	UFUNCTION(BlueprintPure, Category = "Simulation")
+	int32 GetNumContainers() const { return Containers.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Containers per worker batch; below this everything runs on the game thread
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+	int32 MinBatchSize;
+
+private:
+	void SimulateStep(const FSimulationStepContext& Step);
+	void PredictNextEvent(double& InOutSeconds) const;
+	void RebuildPlumbing();
+
+	UPROPERTY()
+	TArray<AHydroponicsContainer*> Containers;
+
+	// Parallel to Containers, refilled every step
+	TArray<FContainerChemistryState> States;
+
+	FHydroFlowNetwork FlowNetwork;
+	bool bPlumbingDirty;
+
+	UPROPERTY()
+	UTimeManager* TimeManager;
+
+	FDelegateHandle SimulationStepHandle;
+	FDelegateHandle PredictNextEventHandle;
+};
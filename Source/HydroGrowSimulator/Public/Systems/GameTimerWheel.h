@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameTimerWheel.generated.h"
+
+/** Handle to a game-time callback scheduled through UTimeManager */
+USTRUCT(BlueprintType)
+struct HYDROGROWSIMULATOR_API FGameTimerHandle
+{
+	GENERATED_BODY()
+
+	FGameTimerHandle()
+		: Handle(0)
+	{
+	}
+
+	bool IsValid() const { return Handle != 0; }
+	void Invalidate() { Handle = 0; }
+
+	bool operator==(const FGameTimerHandle& Other) const { return Handle == Other.Handle; }
+	bool operator!=(const FGameTimerHandle& Other) const { return Handle != Other.Handle; }
+
+private:
+	friend class FGameTimerWheel;
+
+	// Low 32 bits: node index + 1, high 32 bits: node generation
+	uint64 Handle;
+};
+
+/**
+ * Hierarchical timing wheel keyed on whole game ticks.
+ *
+ * Five levels of 256 slots cover 2^40 ticks ahead of the current tick; anything later waits
+ * in an overflow list until the top level wraps. Nodes live in a pooled array and slots are
+ * intrusive lists, so Schedule and Cancel are O(1) and never allocate once the pool is warm.
+ * Each level keeps an occupancy bitmap, which lets Advance jump straight to the next occupied
+ * slot instead of walking every tick, so a multi-day jump costs the same as a single step
+ * when nothing is scheduled. Callbacks fire in deadline order.
+ */
+class HYDROGROWSIMULATOR_API FGameTimerWheel
+{
+public:
+	FGameTimerWheel();
+
+	// Drop every timer (outstanding handles become invalid) and restart at StartTick
+	void Reset(uint64 StartTick = 0);
+
+	// Pre-size the node pool so scheduling during play never grows it
+	void Reserve(int32 NumTimers);
+
+	// Deadlines at or before the current tick fire on the next advance
+	FGameTimerHandle Schedule(uint64 DeadlineTick, FSimpleDelegate Callback);
+
+	// Returns false if the timer already fired or was cancelled. Always invalidates Handle.
+	bool Cancel(FGameTimerHandle& Handle);
+
+	bool IsScheduled(const FGameTimerHandle& Handle) const;
+	bool GetDeadline(const FGameTimerHandle& Handle, uint64& OutDeadlineTick) const;
+
+	// Earliest pending deadline. Only the first occupied slot is scanned, not the whole wheel.
+	bool PeekNextDeadline(uint64& OutDeadlineTick) const;
+
+	// Fire everything due up to and including TargetTick, in deadline order. OnReachTick runs
+	// before each batch with that batch's tick so the owner can bring its own clock along.
+	// Returns the number of callbacks fired.
+	int32 Advance(uint64 TargetTick, TFunctionRef<void(uint64)> OnReachTick);
+	int32 Advance(uint64 TargetTick);
+
+	uint64 GetCurrentTick() const { return CurrentTick; }
+	int32 Num() const { return NumScheduled; }
+
+private:
+	static constexpr int32 SlotBits = 8;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr uint64 SlotMask = NumSlots - 1;
+	static constexpr int32 NumLevels = 5;
+	static constexpr int32 WordsPerLevel = NumSlots / 64;
+
+	// List ids beyond the wheel levels
+	static constexpr uint8 OverflowList = NumLevels;
+	static constexpr uint8 DueList = NumLevels + 1;
+	static constexpr uint8 FreeList = 0xFF;
+
+	struct FTimerNode
+	{
+		uint64 Deadline;
+		FSimpleDelegate Callback;
+		int32 Prev;
+		int32 Next;
+		uint32 Generation;
+		uint8 List;
+		uint8 Slot;
+
+		FTimerNode()
+			: Deadline(0)
+			, Prev(INDEX_NONE)
+			, Next(INDEX_NONE)
+			, Generation(1)
+			, List(FreeList)
+			, Slot(0)
+		{
+		}
+	};
+
+	TArray<FTimerNode> Nodes;
+	int32 FreeHead;
+	int32 NumScheduled;
+	uint64 CurrentTick;
+	bool bAdvancing;
+
+	int32 SlotHeads[NumLevels][NumSlots];
+	uint64 Occupancy[NumLevels][WordsPerLevel];
+	int32 OverflowHead;
+	int32 DueHead;
+
+	int32 AllocateNode();
+	void FreeNode(int32 Index);
+	int32 ResolveHandle(const FGameTimerHandle& Handle) const;
+
+	int32& GetListHead(uint8 List, uint8 Slot);
+	uint64 GetListMinDeadline(int32 Head) const;
+	void LinkTail(int32& Head, int32 Index);
+	void Unlink(int32 Index);
+
+	// Put a node in the list matching its deadline relative to CurrentTick
+	void Place(int32 Index);
+
+	// Re-place every node of a list relative to CurrentTick
+	void Cascade(uint8 List, uint8 Slot);
+
+	int32 FindOccupiedSlot(int32 Level, int32 FromSlot) const;
+	int32 FireDue();
+};
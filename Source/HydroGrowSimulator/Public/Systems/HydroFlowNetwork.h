@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FContainerChemistryState;
+
+/**
+ * Water and nutrient transport between containers and the reservoirs that supply them.
+ *
+ * Each container with a supply reservoir is linked to it by a pump edge whose conductance
+ * (litres per game hour at a full level difference) comes from the container's flow rate and
+ * type efficiency. A step first solves the implicit (backward Euler) water system
+ *
+ *     (C + dt * L) h' = C h
+ *
+ * where C is the diagonal of node capacities and L the conductance-weighted graph Laplacian.
+ * The matrix is symmetric positive definite, so a Jacobi-preconditioned conjugate gradient
+ * solve converges quickly and stays stable for coarse hour-long steps.
+ *
+ * The solved levels give the litres moved along each edge. Nutrients are then carried with
+ * that flow at the upstream concentration, on top of the pump's circulation exchange:
+ *
+ *     (V' + dt * L + U) c' = V c
+ *
+ * where U holds the upwind advection terms. That matrix is not symmetric, so it is solved with
+ * Jacobi-preconditioned BiCGSTAB. Its column sums equal the old volumes, so totals of water
+ * and nutrient mass are conserved and a uniform concentration stays uniform.
+ *
+ * The sparsity pattern is stored as CSR and only rebuilt when plumbing changes; every buffer is
+ * sized there, so stepping never allocates.
+ */
+class HYDROGROWSIMULATOR_API FHydroFlowNetwork
+{
+public:
+	FHydroFlowNetwork();
+
+	// SupplyIndex[i] is the node feeding node i, or INDEX_NONE. Allocates; call only when plumbing changes.
+	void SetTopology(const TArray<int32>& SupplyIndex);
+
+	// Transport water and nutrients across the network. States must match the topology's node count.
+	void Step(TArrayView<FContainerChemistryState> States, float DeltaTime);
+
+	int32 GetNumNodes() const { return NumNodes; }
+	int32 GetNumEdges() const { return EdgeNodes.Num(); }
+	int32 GetLastIterations() const { return LastIterations; }
+
+	// Relative residual at which a solve stops
+	double Tolerance;
+	int32 MaxIterations;
+
+private:
+	int32 NumNodes;
+	int32 LastIterations;
+
+	// Edge e links EdgeNodes[e] (the fed container, which owns the pump) to EdgeSupply[e]
+	TArray<int32> EdgeNodes;
+	TArray<int32> EdgeSupply;
+
+	// CSR of the off-diagonal entries; OffDiagEdge maps each entry back to its edge
+	TArray<int32> RowStart;
+	TArray<int32> ColIndex;
+	TArray<int32> OffDiagEdge;
+
+	// Per-step values; EdgeWeight is conductance * step length (litres per unit level difference),
+	// EdgeFlow the litres moved from the supply into the fed container over the step
+	TArray<double> EdgeWeight;
+	TArray<double> EdgeFlow;
+	TArray<double> OffDiagValue;
+	TArray<double> Diagonal;
+	TArray<double> OldVolume;
+	TArray<double> NewVolume;
+
+	// Solver vectors
+	TArray<double> X;
+	TArray<double> B;
+	TArray<double> R;
+	TArray<double> Z;
+	TArray<double> P;
+	TArray<double> AP;
+	TArray<double> RHat;
+	TArray<double> SHat;
+	TArray<double> T;
+
+	// Diagonal = Volume + sum of incident edge weights; off-diagonals = -weight
+	void BuildSystem(const TArray<double>& Volume);
+	// Upwind terms for EdgeFlow: outflow on the upstream diagonal, inflow off-diagonal downstream
+	void AddAdvection();
+	void Multiply(const TArray<double>& In, TArray<double>& Out) const;
+	int32 SolveConjugateGradient();
+	int32 SolveBiCGStab();
+};
@@ -6,11 +6,15 @@
 #include "Engine/ActorChannel.h"
 #include "Core/HydroGrowTypes.h"
 #include "Network/HydroGrowNetworkTypes.h"
+#include "Systems/SignificanceSubsystem.h"
 #include "HydroponicsContainer.generated.h"
 
 class APlantActor;
 class UStaticMeshComponent;
 class UBoxComponent;
+class APlayerState;
+class AHydroGrowPlayerController;
+struct FContainerChemistryState;
 
 USTRUCT(BlueprintType)
 struct FPlantSlot
@@ -53,6 +57,62 @@ struct TStructOpsTypeTraits<FPlantSlot> : public TStructOpsTypeTraitsBase2<FPlan
 	};
 };
 
+UENUM(BlueprintType)
+enum class EContainerEventType : uint8
+{
+	PlantAdded,
+	PlantRemoved,
+	PHAdjusted,
+	ECAdjusted,
+	NutrientsAdded,
+	PumpStarted,
+	PumpStopped
+};
+
+/** A player interaction with a container. Carries no text; consumers that display it call ToString. */
+USTRUCT(BlueprintType)
+struct FContainerEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Container")
+	EContainerEventType Type;
+
+	// APlayerState::GetPlayerId of the acting player, or INDEX_NONE for server and local actions
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Container")
+	int32 PlayerHandle;
+
+	// Plant species for plant events
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Container")
+	FName Subject;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Container")
+	int32 SlotIndex;
+
+	// New pH or EC level; EC after mixing for added nutrients
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Container")
+	float Value;
+
+	FContainerEvent()
+	{
+		Type = EContainerEventType::PlantAdded;
+		PlayerHandle = INDEX_NONE;
+		Subject = NAME_None;
+		SlotIndex = -1;
+		Value = 0.0f;
+	}
+
+	FContainerEvent(EContainerEventType InType, int32 InPlayerHandle, float InValue = 0.0f)
+		: FContainerEvent()
+	{
+		Type = InType;
+		PlayerHandle = InPlayerHandle;
+		Value = InValue;
+	}
+
+	HYDROGROWSIMULATOR_API FString ToString() const;
+};
+
 UCLASS()
 class HYDROGROWSIMULATOR_API AHydroponicsContainer : public AActor
 {
@@ -63,78 +123,64 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
-	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+	virtual void PostRepNotifies() override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 
 public:
+	// Called every frame by Tick, or at the significance tier's cadence once USignificanceSubsystem manages the container
+	void UpdateVisualEffects();
+
+	void SetSignificanceTier(ESignificanceTier Tier) { SignificanceTier = Tier; }
+
+	UFUNCTION(BlueprintPure, Category = "Container")
+	ESignificanceTier GetSignificanceTier() const { return SignificanceTier; }
+
 	UFUNCTION(BlueprintCallable, Category = "Container")
 	void InitializeContainer(EContainerType Type, int32 PlantCapacity);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
 	bool CanPlantSeed(int32 SlotIndex) const;
 
+	// On a client these are predicted and sent through InstigatingController (or the only local player's controller)
 	UFUNCTION(BlueprintCallable, Category = "Container")
-	bool PlantSeed(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID = TEXT(""));
-
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_PlantSeed(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID);
-	bool Server_PlantSeed_Validate(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID);
-	void Server_PlantSeed_Implementation(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID);
+	bool PlantSeed(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID = TEXT(""), AHydroGrowPlayerController* InstigatingController = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
-	bool RemovePlant(int32 SlotIndex, const FString& PlayerID = TEXT(""));
-
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_RemovePlant(int32 SlotIndex, const FString& PlayerID);
-	bool Server_RemovePlant_Validate(int32 SlotIndex, const FString& PlayerID);
-	void Server_RemovePlant_Implementation(int32 SlotIndex, const FString& PlayerID);
+	bool RemovePlant(int32 SlotIndex, const FString& PlayerID = TEXT(""), AHydroGrowPlayerController* InstigatingController = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
 	int32 GetAvailableSlot() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
-	void SetPHLevel(float NewPH, const FString& PlayerID = TEXT(""));
-
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_SetPHLevel(float NewPH, const FString& PlayerID);
-	bool Server_SetPHLevel_Validate(float NewPH, const FString& PlayerID);
-	void Server_SetPHLevel_Implementation(float NewPH, const FString& PlayerID);
+	void SetPHLevel(float NewPH, const FString& PlayerID = TEXT(""), AHydroGrowPlayerController* InstigatingController = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
-	void SetECLevel(float NewEC, const FString& PlayerID = TEXT(""));
-
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_SetECLevel(float NewEC, const FString& PlayerID);
-	bool Server_SetECLevel_Validate(float NewEC, const FString& PlayerID);
-	void Server_SetECLevel_Implementation(float NewEC, const FString& PlayerID);
+	void SetECLevel(float NewEC, const FString& PlayerID = TEXT(""), AHydroGrowPlayerController* InstigatingController = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
 	void SetWaterLevel(float NewLevel);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
-	void AddNutrients(const FNutrientLevels& Nutrients, const FString& PlayerID = TEXT(""));
-
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_AddNutrients(const FNutrientLevels& Nutrients, const FString& PlayerID);
-	bool Server_AddNutrients_Validate(const FNutrientLevels& Nutrients, const FString& PlayerID);
-	void Server_AddNutrients_Implementation(const FNutrientLevels& Nutrients, const FString& PlayerID);
+	void AddNutrients(const FNutrientLevels& Nutrients, const FString& PlayerID = TEXT(""), AHydroGrowPlayerController* InstigatingController = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
-	void StartWaterPump(const FString& PlayerID = TEXT(""));
+	void StartWaterPump(const FString& PlayerID = TEXT(""), AHydroGrowPlayerController* InstigatingController = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Container")
-	void StopWaterPump(const FString& PlayerID = TEXT(""));
-
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_StartWaterPump(const FString& PlayerID);
-	bool Server_StartWaterPump_Validate(const FString& PlayerID);
-	void Server_StartWaterPump_Implementation(const FString& PlayerID);
-	
-	UFUNCTION(Server, Reliable, WithValidation)
-	void Server_StopWaterPump(const FString& PlayerID);
-	bool Server_StopWaterPump_Validate(const FString& PlayerID);
-	void Server_StopWaterPump_Implementation(const FString& PlayerID);
+	void StopWaterPump(const FString& PlayerID = TEXT(""), AHydroGrowPlayerController* InstigatingController = nullptr);
+
+	// Server commands behind the actions above, also replayed by the simulation journal.
+	// PlayerHandle is the acting player's APlayerState::GetPlayerId, reported in FContainerEvent.
+	void ExecutePlantSeed(FName PlantSpeciesID, int32 SlotIndex, const FString& PlayerID, int32 PlayerHandle = INDEX_NONE);
+	void ExecuteRemovePlant(int32 SlotIndex, const FString& PlayerID, int32 PlayerHandle = INDEX_NONE);
+	void ExecuteSetPHLevel(float NewPH, const FString& PlayerID, int32 PlayerHandle = INDEX_NONE);
+	void ExecuteSetECLevel(float NewEC, const FString& PlayerID, int32 PlayerHandle = INDEX_NONE);
+	void ExecuteAddNutrients(const FNutrientLevels& Nutrients, const FString& PlayerID, int32 PlayerHandle = INDEX_NONE);
+	void ExecuteStartWaterPump(const FString& PlayerID, int32 PlayerHandle = INDEX_NONE);
+	void ExecuteStopWaterPump(const FString& PlayerID, int32 PlayerHandle = INDEX_NONE);
 
 	UFUNCTION(BlueprintPure, Category = "Container")
 	EContainerType GetContainerType() const { return ContainerType; }
@@ -142,6 +188,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Container")
 	const FEnvironmentalConditions& GetEnvironmentalConditions() const { return CurrentConditions; }
 
+	UFUNCTION(BlueprintPure, Category = "Container")
+	const FNutrientLevels& GetNutrientSolution() const { return NutrientSolution; }
+
 	UFUNCTION(BlueprintPure, Category = "Container")
 	int32 GetPlantCount() const;
 
@@ -157,6 +206,55 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Container")
 	TArray<APlantActor*> GetAllPlants() const;
 
+	// Plumbing: this container's pump exchanges water and nutrients with the reservoir
+	UFUNCTION(BlueprintCallable, Category = "Plumbing")
+	void SetSupplyReservoir(AHydroponicsContainer* Reservoir);
+
+	UFUNCTION(BlueprintPure, Category = "Plumbing")
+	AHydroponicsContainer* GetSupplyReservoir() const { return SupplyReservoir; }
+
+	// Chemistry simulation hand-off, used by UContainerSimulationSubsystem on the game thread
+	void GatherChemistryState(FContainerChemistryState& OutState) const;
+	void ApplyChemistryState(const FContainerChemistryState& State);
+
+	// Bitwise hash of the simulated state, for journal replay comparison
+	uint32 GetSimulationStateHash() const;
+
+	// Stable identity for simulation streams and the journal (0 until registered on the server)
+	UFUNCTION(BlueprintPure, Category = "Simulation")
+	int32 GetSimulationID() const { return SimulationID; }
+
+	// Restores a saved ID; only takes effect before BeginPlay (e.g. on a deferred spawn)
+	void SetSimulationID(int32 InSimulationID) { SimulationID = InSimulationID; }
+
+	// Client: times this copy was found to differ from the server's. Server: divergence reports received.
+	UFUNCTION(BlueprintPure, Category = "Network")
+	int32 GetDivergenceCount() const { return DivergenceCount; }
+
+	// Server: a plant's replicated state changed, so the digest must be rebuilt
+	void MarkStateDigestDirty() { bStateDigestDirty = true; }
+
+	// Server: a client found its copy differs from the replicated state (see CheckForDivergence)
+	void HandleDivergenceReport(const APlayerState* Reporter, int32 FirstMismatchField);
+
+	// Server: runs a client's action under PlayerID's permissions, reporting PlayerHandle in the event.
+	// Returns false if it was rejected or changed nothing.
+	bool ExecuteAction(const FContainerActionRequest& Request, const FString& PlayerID, int32 PlayerHandle);
+
+	// Server: the replicated state now includes the player's actions up to PredictionKey
+	void AcknowledgePredictions(int32 PlayerId, int32 PredictionKey);
+
+	// Client: shows an action immediately, until the replicated state includes it or the server rejects it
+	void PredictAction(const FContainerActionRequest& Request, int32 PlayerId);
+	void RejectPrediction(int32 PlayerId, int32 PredictionKey);
+
+	// Server: incremented by every accepted command
+	UFUNCTION(BlueprintPure, Category = "Network")
+	int32 GetStateRevision() const { return StateRevision; }
+
+	UFUNCTION(BlueprintPure, Category = "Network")
+	bool HasPendingPredictions() const { return PendingPredictions.Num() > 0; }
+
 protected:
 	// Core Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -175,18 +273,18 @@ protected:
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "Container Setup")
 	EContainerType ContainerType;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Container Setup")
+	UPROPERTY(ReplicatedUsing = OnRep_PlantSlots, VisibleAnywhere, BlueprintReadOnly, Category = "Container Setup")
 	TArray<FPlantSlot> PlantSlots;
 
 	// Environmental Conditions
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
+	UPROPERTY(ReplicatedUsing = OnRep_CurrentConditions, VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
 	FEnvironmentalConditions CurrentConditions;
 
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
+	UPROPERTY(ReplicatedUsing = OnRep_NutrientSolution, VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
 	FNutrientLevels NutrientSolution;
 
 	// System State
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "System")
+	UPROPERTY(ReplicatedUsing = OnRep_PumpRunning, VisibleAnywhere, BlueprintReadOnly, Category = "System")
 	bool bPumpRunning;
 
 	// Network State
@@ -196,9 +294,34 @@ protected:
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "Network")
 	bool bIsSharedContainer;
 
+	// Server digest of the replicated simulation state; rebuilt only when the state changed
+	UPROPERTY(ReplicatedUsing = OnRep_StateDigest)
+	FStateDigest StateDigest;
+
+	// Server: incremented by every accepted command
+	int32 StateRevision;
+
+	// Per player, the last predicted action included in the state above; replicates with it, so a
+	// client drops a prediction in the same update that delivers its result
+	UPROPERTY(Replicated)
+	TArray<FPredictionAck> PredictionAcks;
+
+	// Seconds between client divergence checks (also checked whenever the digest arrives)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Network")
+	float DivergenceCheckInterval;
+
+	// Fraction of capacity exchanged with the supply reservoir per game hour at a full level difference
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "System")
 	float WaterFlowRate;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Plumbing")
+	AHydroponicsContainer* SupplyReservoir;
+
+	// Persistent across sessions and saved with the container. Keys this container's random
+	// stream in the chemistry kernel, so drift noise does not depend on actor names or spawn order.
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Simulation")
+	int32 SimulationID;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "System")
 	float EnergyConsumptionRate;
 
@@ -216,17 +339,66 @@ protected:
 	TMap<EContainerType, float> TypeEfficiencyMultipliers;
 
 private:
-	void UpdateEnvironmentalConditions(float DeltaTime);
-	void UpdateWaterSystem(float DeltaTime);
-	void UpdateNutrientDistribution();
 	void UpdatePlantConditions();
 	void CreatePlantSlots(int32 Capacity);
-	void UpdateVisualEffects();
 
-	// Environmental drift simulation
-	void SimulatePHDrift(float DeltaTime);
-	void SimulateNutrientDepletion(float DeltaTime);
-	void SimulateWaterEvaporation(float DeltaTime);
+	ESignificanceTier SignificanceTier;
+	bool bSignificanceManaged;
+
+	// Shared by the server command and client prediction so both clamp the same way
+	void MixNutrients(const FNutrientLevels& Nutrients);
+
+	// Marks an accepted command: bumps the revision and the digest
+	void CommitCommand();
+
+	// Client prediction: authoritative state plus the actions still in flight
+	void ApplyPredictedAction(const FContainerActionRequest& Request);
+	void ReconcilePredictions();
+
+	UFUNCTION()
+	void OnRep_PlantSlots();
+
+	UFUNCTION()
+	void OnRep_CurrentConditions();
+
+	UFUNCTION()
+	void OnRep_NutrientSolution();
+
+	UFUNCTION()
+	void OnRep_PumpRunning();
+
+	int32 GetAcknowledgedPredictionKey(int32 PlayerId) const;
+
+	struct FPendingPrediction
+	{
+		FContainerActionRequest Request;
+
+		// Prediction keys are per player
+		int32 PlayerId = INDEX_NONE;
+	};
+
+	TArray<FPendingPrediction> PendingPredictions;
+
+	// Last replicated values; the predicted copies above are rebuilt from these
+	TArray<FPlantSlot> AuthoritativeSlots;
+	FEnvironmentalConditions AuthoritativeConditions;
+	FNutrientLevels AuthoritativeNutrients;
+	bool bAuthoritativePumpRunning;
+
+	void BuildStateDigest(FStateDigest& OutDigest) const;
+	void CheckForDivergence();
+	static const TCHAR* GetDigestFieldName(int32 Field);
+
+	UFUNCTION()
+	void OnRep_StateDigest();
+
+	bool bStateDigestDirty;
+	bool bDiverged;
+	int32 DivergenceCount;
+
+	// Client: when the current mismatch was first seen, or negative if the last check matched
+	double MismatchStartTime;
+	FTimerHandle DivergenceCheckTimer;
 
 public:
 	// Permission checking
@@ -236,13 +408,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Network")
 	void SetContainerOwner(const FString& PlayerID);
 
+	UFUNCTION(BlueprintPure, Category = "Network")
+	const FString& GetOwnerPlayerID() const { return OwnerPlayerID; }
+
 	UFUNCTION(BlueprintCallable, Category = "Network")
 	void SetSharedAccess(bool bShared);
 
+	// Display text for an interaction event
+	UFUNCTION(BlueprintPure, Category = "Container")
+	static FString DescribeEvent(const FContainerEvent& Event) { return Event.ToString(); }
+
 	// Delegates
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlantAdded, APlantActor*, Plant);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlantRemoved, int32, SlotIndex);
-	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnContainerInteraction, const FString&, PlayerID, const FString&, Action);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnContainerInteraction, const FContainerEvent&, Event);
 
 	UPROPERTY(BlueprintAssignable)
 	FOnPlantAdded OnPlantAdded;
@@ -259,5 +438,6 @@ public:
 private:
 	// Network permission helpers
 	class AHydroGrowNetworkGameMode* GetNetworkGameMode() const;
+	static EContainerPermission GetActionPermission(EContainerAction Action);
 	bool HasPermission(const FString& PlayerID, EContainerPermission Permission) const;
 };
\ No newline at end of file
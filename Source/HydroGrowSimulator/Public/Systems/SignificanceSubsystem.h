@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SignificanceSubsystem.generated.h"
+
+class APlantActor;
+class AHydroponicsContainer;
+
+UENUM(BlueprintType)
+enum class ESignificanceTier : uint8
+{
+	Near		UMETA(DisplayName = "Near"),		// Close to a player: every update, full simulation
+	Visible		UMETA(DisplayName = "Visible"),		// On screen or in mid range: throttled visuals
+	Distant		UMETA(DisplayName = "Distant")		// Off screen and far: no visuals, deferred simulation
+};
+
+USTRUCT(BlueprintType)
+struct FSignificanceTierSettings
+{
+	GENERATED_BODY()
+
+	// Entities within this distance (cm) of a player qualify for the tier; unused for Distant
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	float MaxDistance;
+
+	// Seconds between visual updates; 0 updates every frame, negative never
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	float VisualInterval;
+
+	// Visual updates per frame in this tier; the rest wait for the next frame
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	int32 MaxVisualUpdatesPerFrame;
+
+	// Game seconds a plant may go unsimulated before catching up in one closed-form step; 0 never defers
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	float MaxDeferredGameSeconds;
+
+	FSignificanceTierSettings()
+	{
+		MaxDistance = 0.0f;
+		VisualInterval = 0.0f;
+		MaxVisualUpdatesPerFrame = 0;
+		MaxDeferredGameSeconds = 0.0f;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FSignificanceTierStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Significance")
+	int32 Entities;
+
+	// Last frame
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Significance")
+	int32 VisualUpdates;
+
+	// Last frame: due but over the tier's budget
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Significance")
+	int32 VisualUpdatesDeferred;
+
+	FSignificanceTierStats()
+	{
+		Entities = 0;
+		VisualUpdates = 0;
+		VisualUpdatesDeferred = 0;
+	}
+};
+
+/**
+ * Sorts plants and containers into tiers by distance to the nearest player and whether they were
+ * rendered recently, and spends update work by tier.
+ *
+ * Visual updates run at each tier's interval, capped per tier per frame and handed out round
+ * robin. Registered plants always queue visual changes for this pass, so however many state
+ * changes and rep-notifies land in a frame, each plant is redrawn at most once.
+ *
+ * Plants in tiers with MaxDeferredGameSeconds accumulate fine simulation steps and catch up in one
+ * closed-form coarse step when the bound is reached, when promoted, or when an action needs their
+ * current state. Container chemistry is already batched across the world and coupled through the
+ * flow network, so it always runs at full cadence.
+ *
+ * Console: HydroGrow.Significance.Stats
+ */
+UCLASS()
+class HYDROGROWSIMULATOR_API USignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	USignificanceSubsystem();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterPlant(APlantActor* Plant);
+	void RegisterContainer(AHydroponicsContainer* Container);
+	void Unregister(AActor* Actor);
+
+	// Journal recording and replay need every plant stepped identically, wherever players stand
+	void SetSimulationDeferralEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = "Significance")
+	FSignificanceTierStats GetTierStats(ESignificanceTier Tier) const;
+
+	void LogStats() const;
+
+	static USignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Indexed by ESignificanceTier
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	TArray<FSignificanceTierSettings> TierSettings;
+
+	// Seconds between reclassifications
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	float ClassifyInterval;
+
+	// Seconds since last render for an entity to still count as on screen
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Significance")
+	float OnScreenTolerance;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		ESignificanceTier Tier = ESignificanceTier::Near;
+		double LastVisualUpdateTime = 0.0;
+		bool bIsPlant = false;
+		bool bClassified = false;
+	};
+
+	void Classify();
+	ESignificanceTier ClassifyActor(const AActor* Actor) const;
+	void ApplyTier(FEntry& Entry, ESignificanceTier Tier) const;
+	void UpdateVisuals(double Now);
+	const FSignificanceTierSettings& GetSettings(ESignificanceTier Tier) const;
+
+	TArray<FEntry> Entries;
+	TArray<FVector> ViewLocations;
+	TArray<FSignificanceTierStats> Stats;
+	float TimeSinceClassify;
+	int32 VisualCursor;
+	bool bSimulationDeferralEnabled;
+};
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/SaveGame.h"
+#include "Core/HydroGrowTypes.h"
+#include "Systems/TimeManager.h"
+#include "SimulationJournal.generated.h"
+
+UENUM(BlueprintType)
+enum class EJournalCommand : uint8
+{
+	PlantSeed,
+	RemovePlant,
+	HarvestPlant,
+	SetPHLevel,
+	SetECLevel,
+	SetWaterLevel,
+	AddNutrients,
+	StartWaterPump,
+	StopWaterPump,
+	SetSupplyReservoir,
+	SetTimeMode			// Informational on replay; recorded step lengths already carry its effect
+};
+
+/** One authoritative mutation, applied before the simulation step StepIndex */
+USTRUCT(BlueprintType)
+struct FJournalEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int64 StepIndex;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	EJournalCommand Command;
+
+	// Simulation ID of the container or plant the command targets
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int32 TargetID;
+
+	// Plant species or time mode, depending on the command
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	FName Argument;
+
+	// Simulation ID of the supply reservoir for SetSupplyReservoir (0 disconnects)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int32 ArgumentID;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int32 SlotIndex;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	float Value;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	FNutrientLevels Nutrients;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	FString PlayerID;
+
+	FJournalEntry()
+	{
+		StepIndex = 0;
+		Command = EJournalCommand::PlantSeed;
+		TargetID = 0;
+		Argument = NAME_None;
+		ArgumentID = 0;
+		SlotIndex = -1;
+		Value = 0.0f;
+	}
+
+	FJournalEntry(EJournalCommand InCommand, int32 InTargetID, const FString& InPlayerID)
+		: FJournalEntry()
+	{
+		Command = InCommand;
+		TargetID = InTargetID;
+		PlayerID = InPlayerID;
+	}
+};
+
+/** One recorded simulation step and the world state hash after it */
+USTRUCT(BlueprintType)
+struct FJournalStep
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int64 StepIndex;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	float DeltaGameSeconds;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	ESimulationTier Tier;
+
+	// 0 when the step was not hashed (see HashIntervalSteps)
+	UPROPERTY(VisibleAnywhere, Category = "Journal")
+	uint32 StateHash;
+
+	FJournalStep()
+	{
+		StepIndex = 0;
+		DeltaGameSeconds = 0.0f;
+		Tier = ESimulationTier::Fine;
+		StateHash = 0;
+	}
+};
+
+/** A recorded session, stored in a save slot */
+UCLASS()
+class HYDROGROWSIMULATOR_API USimulationJournalRecording : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+	// Map the recording started on; replay must start from the same level
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	FString MapName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int64 StartGameTicks;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int64 StartStepIndex;
+
+	// Next simulation ID when recording started, so replayed spawns get the recorded IDs
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	int32 StartNextSimulationID;
+
+	// World state hash when recording started
+	UPROPERTY(VisibleAnywhere, Category = "Journal")
+	uint32 StartStateHash;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	TArray<FJournalEntry> Entries;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Journal")
+	TArray<FJournalStep> Steps;
+};
+
+/**
+ * Records every authoritative mutation (server RPCs, harvests, plumbing, time mode) with the
+ * simulation step it applies before, plus the length and resulting state hash of each step.
+ *
+ * Replay re-executes a recording synchronously on the same map: commands are applied at their
+ * steps, each step is run directly on the time manager and the world hash compared with the
+ * recorded one. The first divergence is reported, and the run doubles as a workload benchmark.
+ *
+ * Console: HydroGrow.Journal.Record, HydroGrow.Journal.Stop [Slot], HydroGrow.Journal.Replay [Slot]
+ */
+UCLASS()
+class HYDROGROWSIMULATOR_API USimulationJournal : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	USimulationJournal();
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category = "Journal")
+	void StartRecording();
+
+	// Stops recording and writes the journal to a save slot. Returns false if nothing was recording.
+	UFUNCTION(BlueprintCallable, Category = "Journal")
+	bool StopRecording(const FString& SlotName);
+
+	// Replays a journal from a save slot. Returns the number of steps whose hash did not match, or -1 on error.
+	UFUNCTION(BlueprintCallable, Category = "Journal")
+	int32 Replay(const FString& SlotName);
+
+	UFUNCTION(BlueprintPure, Category = "Journal")
+	bool IsRecording() const { return Recording != nullptr; }
+
+	// Called from authoritative mutation points; a no-op unless recording
+	void Record(const FJournalEntry& Entry);
+
+	// Order-independent hash over every container and plant's simulated state
+	uint32 ComputeWorldStateHash() const;
+
+	// Server: gives a simulated actor its stable ID. A saved ID is kept unless another live actor
+	// holds it; otherwise the next ID in sequence is assigned. Returns the ID the actor should use.
+	int32 RegisterSimulationActor(AActor* Actor, int32 SimulationID);
+	void UnregisterSimulationActor(const AActor* Actor, int32 SimulationID);
+	AActor* FindSimulationActor(int32 SimulationID) const;
+
+	static USimulationJournal* Get(const UObject* WorldContextObject);
+
+	// The journal only while it is recording, so callers skip building entries otherwise
+	static USimulationJournal* GetIfRecording(const UObject* WorldContextObject);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Hash the world every N steps while recording (hashing visits every container and plant)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Journal")
+	int32 HashIntervalSteps;
+
+private:
+	void OnSimulationStepComplete(const FSimulationStepContext& Step);
+
+	UFUNCTION()
+	void HandleTimeModeChanged(EGameTimeMode NewMode);
+
+	void ApplyEntry(const FJournalEntry& Entry);
+
+	UPROPERTY()
+	USimulationJournalRecording* Recording;
+
+	UPROPERTY()
+	UTimeManager* TimeManager;
+
+	TMap<int32, TWeakObjectPtr<AActor>> SimulationActors;
+	int32 NextSimulationID;
+
+	FDelegateHandle StepCompleteHandle;
+};
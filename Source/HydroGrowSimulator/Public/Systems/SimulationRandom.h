@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counter-based random numbers for the simulation (Philox4x32-10, Salmon et al. 2011).
+ *
+ * A draw is a pure function of a key (which stream, e.g. one container) and a counter (which
+ * simulation step), so results do not depend on thread scheduling, batch order or whether a
+ * step runs live or during offline catch-up. There is no state to share, so any worker thread
+ * can draw, and the branch-free rounds vectorize across containers.
+ */
+namespace SimulationRandom
+{
+	// Distinct purposes drawing from the same stream and step
+	enum class EStreamPurpose : uint32
+	{
+		PHDrift = 1,
+	};
+
+	FORCEINLINE constexpr void MulHiLo(uint32 A, uint32 B, uint32& OutHi, uint32& OutLo)
+	{
+		const uint64 Product = static_cast<uint64>(A) * B;
+		OutHi = static_cast<uint32>(Product >> 32);
+		OutLo = static_cast<uint32>(Product);
+	}
+
+	// Four independent 32-bit outputs for (Key, Counter)
+	FORCEINLINE constexpr void Philox4x32(uint32 Key0, uint32 Key1, uint32 C0, uint32 C1, uint32 C2, uint32 C3, uint32 Out[4])
+	{
+		constexpr uint32 M0 = 0xD2511F53u;
+		constexpr uint32 M1 = 0xCD9E8D57u;
+		constexpr uint32 W0 = 0x9E3779B9u;
+		constexpr uint32 W1 = 0xBB67AE85u;
+
+		for (int32 Round = 0; Round < 10; Round++)
+		{
+			uint32 Hi0, Lo0, Hi1, Lo1;
+			MulHiLo(M0, C0, Hi0, Lo0);
+			MulHiLo(M1, C2, Hi1, Lo1);
+
+			C0 = Hi1 ^ C1 ^ Key0;
+			C1 = Lo1;
+			C2 = Hi0 ^ C3 ^ Key1;
+			C3 = Lo0;
+
+			Key0 += W0;
+			Key1 += W1;
+		}
+
+		Out[0] = C0;
+		Out[1] = C1;
+		Out[2] = C2;
+		Out[3] = C3;
+	}
+
+	namespace Private
+	{
+		constexpr bool MatchesKnownAnswer(uint32 Key0, uint32 Key1, uint32 C0, uint32 C1, uint32 C2, uint32 C3,
+			uint32 E0, uint32 E1, uint32 E2, uint32 E3)
+		{
+			uint32 Out[4] = {};
+			Philox4x32(Key0, Key1, C0, C1, C2, C3, Out);
+			return Out[0] == E0 && Out[1] == E1 && Out[2] == E2 && Out[3] == E3;
+		}
+	}
+
+	// Known-answer vectors for Philox4x32-10 from Random123 (kat_vectors)
+	static_assert(Private::MatchesKnownAnswer(0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+		0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u), "Philox4x32-10 known-answer mismatch");
+	static_assert(Private::MatchesKnownAnswer(0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu,
+		0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu), "Philox4x32-10 known-answer mismatch");
+	static_assert(Private::MatchesKnownAnswer(0xa4093822u, 0x299f31d0u, 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u,
+		0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u), "Philox4x32-10 known-answer mismatch");
+
+	// Top 24 bits as a float in [-1, 1)
+	FORCEINLINE float ToSignedUnit(uint32 Bits)
+	{
+		return static_cast<float>(Bits >> 8) * (2.0f / 16777216.0f) - 1.0f;
+	}
+
+	// Uniform sample in [-1, 1) for a stream at a simulation step
+	FORCEINLINE float SignedUniform(uint32 StreamKey, int64 StepIndex, EStreamPurpose Purpose)
+	{
+		uint32 Bits[4];
+		Philox4x32(StreamKey, static_cast<uint32>(Purpose),
+			static_cast<uint32>(StepIndex), static_cast<uint32>(static_cast<uint64>(StepIndex) >> 32), 0, 0, Bits);
+		return ToSignedUnit(Bits[0]);
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Aggregate of one channel over a block or a query bucket */
+struct FTelemetryAggregate
+{
+	float Min = TNumericLimits<float>::Max();
+	float Max = TNumericLimits<float>::Lowest();
+	double Sum = 0.0;
+	int32 Count = 0;
+
+	void Add(float Value)
+	{
+		Min = FMath::Min(Min, Value);
+		Max = FMath::Max(Max, Value);
+		Sum += Value;
+		Count++;
+	}
+
+	void Merge(const FTelemetryAggregate& Other)
+	{
+		Min = FMath::Min(Min, Other.Min);
+		Max = FMath::Max(Max, Other.Max);
+		Sum += Other.Sum;
+		Count += Other.Count;
+	}
+};
+
+/**
+ * Compressed multi-channel time series: every sample carries one timestamp (seconds) and
+ * NumChannels float values, encoded as in Facebook's Gorilla TSDB (Pelkonen et al. 2015).
+ *
+ * Timestamps are stored as delta-of-delta, so a steady sampling interval costs one bit per
+ * sample. Values are rounded to 1/Quantization and stored as the XOR with the previous value of
+ * the channel; unchanged values cost one bit and slow drift a dozen or so, since rounding leaves
+ * long runs of trailing zeros.
+ *
+ * Samples are packed into blocks of SamplesPerBlock, each with a per-channel min/max/sum, and
+ * blocks are kept in a ring of MaxBlocks. Downsampling uses the summaries of blocks that fall
+ * inside one bucket and only decodes blocks that straddle bucket edges.
+ */
+class HYDROGROWSIMULATOR_API FTelemetrySeries
+{
+public:
+	static constexpr int32 NumChannels = 8;
+	static constexpr int32 SamplesPerBlock = 64;
+	static constexpr float Quantization = 256.0f;
+
+	explicit FTelemetrySeries(int32 InMaxBlocks = 64);
+
+	// Times must increase; out-of-order samples are ignored
+	void Append(int64 Time, const float (&Values)[NumChannels]);
+
+	// Min/max/mean of a channel over OutBuckets.Num() equal buckets spanning [StartTime, EndTime)
+	void Downsample(int32 Channel, int64 StartTime, int64 EndTime, TArrayView<FTelemetryAggregate> OutBuckets) const;
+
+	void Reset();
+
+	int32 GetNumSamples() const;
+	int64 GetFirstTime() const;
+	int64 GetLastTime() const { return LastTime; }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FBlock
+	{
+		int64 FirstTime = 0;
+		int64 LastTime = 0;
+		int32 NumSamples = 0;
+		int32 NumBits = 0;
+		TArray<uint64> Words;
+		FTelemetryAggregate Summary[NumChannels];
+	};
+
+	// Running state of the encoder or decoder within one block
+	struct FCodecState
+	{
+		int64 PrevTime = 0;
+		int64 PrevDelta = 0;
+		uint32 PrevValue[NumChannels] = {};
+		uint8 PrevLeading[NumChannels] = {};
+		uint8 PrevTrailing[NumChannels] = {};
+		bool bHasWindow[NumChannels] = {};
+	};
+
+	FBlock& StartBlock(int64 Time);
+	void DecodeBlock(const FBlock& Block, int32 Channel, TFunctionRef<void(int64 Time, float Value)> Visitor) const;
+
+	// Blocks in chronological order, starting at OldestBlock
+	TArray<FBlock> Blocks;
+	int32 OldestBlock;
+	int32 MaxBlocks;
+
+	// Encoder state for the newest block
+	FCodecState Encoder;
+	int64 LastTime;
+};
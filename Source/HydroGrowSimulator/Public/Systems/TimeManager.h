@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "Systems/GameTimerWheel.h"
 #include "TimeManager.generated.h"
 
 UENUM(BlueprintType)
@@ -51,10 +53,77 @@ struct FGameDateTime
 	{
 		return FString::Printf(TEXT("%d/%d/%d %02d:%02d:%02d"), Month, Day, Year, Hour, Minute, Second);
 	}
+
+	// The game clock is a 64-bit tick count from the start of EpochYear; these fields are a view of it
+	static constexpr int64 TicksPerSecond = 1000;
+	static constexpr int64 TicksPerMinute = TicksPerSecond * 60;
+	static constexpr int64 TicksPerHour = TicksPerMinute * 60;
+	static constexpr int64 TicksPerDay = TicksPerHour * 24;
+	static constexpr int32 DaysPerMonth = 30;
+	static constexpr int32 MonthsPerYear = 12;
+	static constexpr int32 EpochYear = 2025;
+
+	static FGameDateTime FromTicks(int64 Ticks)
+	{
+		const int64 TotalSeconds = FMath::Max<int64>(Ticks, 0) / TicksPerSecond;
+		const int64 TotalMinutes = TotalSeconds / 60;
+		const int64 TotalHours = TotalMinutes / 60;
+		const int64 TotalDays = TotalHours / 24;
+		const int64 TotalMonths = TotalDays / DaysPerMonth;
+
+		FGameDateTime Result;
+		Result.Second = static_cast<int32>(TotalSeconds % 60);
+		Result.Minute = static_cast<int32>(TotalMinutes % 60);
+		Result.Hour = static_cast<int32>(TotalHours % 24);
+		Result.Day = static_cast<int32>(TotalDays % DaysPerMonth) + 1;
+		Result.Month = static_cast<int32>(TotalMonths % MonthsPerYear) + 1;
+		Result.Year = EpochYear + static_cast<int32>(TotalMonths / MonthsPerYear);
+		return Result;
+	}
+
+	int64 ToTicks() const
+	{
+		const int64 TotalDays = (static_cast<int64>(Year - EpochYear) * MonthsPerYear + (Month - 1)) * DaysPerMonth + (Day - 1);
+		const int64 TotalSeconds = ((TotalDays * 24 + Hour) * 60 + Minute) * 60 + Second;
+		return TotalSeconds * TicksPerSecond;
+	}
 };
 
+UENUM(BlueprintType)
+enum class ESimulationTier : uint8
+{
+	Fine		UMETA(DisplayName = "Fine"),		// Small fixed steps, used at normal play speeds
+	Coarse		UMETA(DisplayName = "Coarse")		// Hour-sized analytic chunks for high time scales, skips and offline catch-up
+};
+
+/** Passed to every simulation participant for one fixed step */
+struct FSimulationStepContext
+{
+	// Monotonic index of this step since the time manager started
+	int64 StepIndex;
+
+	// Game seconds covered by this step
+	float DeltaGameSeconds;
+
+	// Coarse steps are long; participants must integrate them in closed form rather than per-second
+	ESimulationTier Tier;
+
+	FSimulationStepContext()
+		: StepIndex(0)
+		, DeltaGameSeconds(0.0f)
+		, Tier(ESimulationTier::Fine)
+	{
+	}
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSimulationStep, const FSimulationStepContext& /*Step*/);
+
+// Participants lower InOutSeconds to the game seconds until their next notable event (stage change, alert)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPredictNextEvent, double& /*InOutSeconds*/);
+DECLARE_DYNAMIC_DELEGATE(FOnGameTimerEvent);
+
 UCLASS()
-class HYDROGROWSIMULATOR_API UTimeManager : public UGameInstanceSubsystem
+class HYDROGROWSIMULATOR_API UTimeManager : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -62,6 +131,12 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickableWhenPaused() const override { return false; }
+
 	UFUNCTION(BlueprintCallable, Category = "Time Management")
 	void SetTimeMode(EGameTimeMode NewMode);
 
@@ -83,8 +158,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Time Management")
 	bool IsTimePaused() const { return CurrentTimeMode == EGameTimeMode::Paused; }
 
+	// Calendar view of the clock, rebuilt only when the tick count has moved
+	UFUNCTION(BlueprintPure, Category = "Game Time")
+	FGameDateTime GetGameDateTime() const;
+
 	UFUNCTION(BlueprintPure, Category = "Game Time")
-	FGameDateTime GetGameDateTime() const { return CurrentGameTime; }
+	int64 GetGameTicks() const { return GameTicks; }
+
+	// Jump the clock to an absolute tick (e.g. when loading a save). Pending game timers are dropped.
+	UFUNCTION(BlueprintCallable, Category = "Game Time")
+	void SetGameTicks(int64 NewGameTicks);
 
 	UFUNCTION(BlueprintPure, Category = "Game Time")
 	float GetTimeOfDay() const;
@@ -110,6 +193,72 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Game Time")
 	void AdvanceTime(float Hours);
 
+	void AdvanceTicks(int64 Ticks);
+
+	// Fixed-step simulation
+	UFUNCTION(BlueprintPure, Category = "Simulation")
+	float GetFixedStepSeconds() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	void SetFixedStepSeconds(EGameTimeMode Mode, float StepSeconds);
+
+	UFUNCTION(BlueprintPure, Category = "Simulation")
+	int64 GetSimulationStepIndex() const { return SimulationStepIndex; }
+
+	// Realign the step counter (journal replay), so per-step random streams match the recording
+	void SetSimulationStepIndex(int64 NewStepIndex) { SimulationStepIndex = NewStepIndex; }
+
+	// Run one step immediately, outside the frame budget. For tools that drive the simulation directly.
+	void StepSimulation(float StepSeconds, ESimulationTier Tier);
+
+	UFUNCTION(BlueprintPure, Category = "Simulation")
+	int32 GetStepsLastFrame() const { return StepsLastFrame; }
+
+	// Coarse once the time scale reaches CoarseTierTimeScaleThreshold
+	UFUNCTION(BlueprintPure, Category = "Simulation")
+	ESimulationTier GetCurrentSimulationTier() const;
+
+	// Simulate forward in coarse chunks until a participant raises an event, a game timer fires
+	// or MaxHours pass. Returns the game hours skipped.
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	float SkipToNextEvent(float MaxHours = 24.0f);
+
+	UFUNCTION(BlueprintPure, Category = "Simulation")
+	bool IsSkippingToEvent() const { return bSkippingToEvent; }
+
+	// Called by participants when something the player should see happens (stops SkipToNextEvent)
+	void NotifySimulationEvent();
+
+	// Simulation participants (plants, containers, economy) bind here instead of integrating frame DeltaTime
+	FOnSimulationStep OnSimulationStep;
+
+	// Broadcast once every participant has stepped and the clock has advanced (observers, journal)
+	FOnSimulationStep OnSimulationStepComplete;
+
+	// Queried before each skip chunk so chunks end exactly on the next predicted event
+	FOnPredictNextEvent OnPredictNextEvent;
+
+	// Game-time events. Callbacks fire in deadline order as the clock advances, including
+	// offline catch-up, with the game clock reading the event's time while they run.
+	FGameTimerHandle ScheduleGameTimer(double DelayGameSeconds, FSimpleDelegate Callback);
+	FGameTimerHandle ScheduleGameTimerAt(int64 GameTick, FSimpleDelegate Callback);
+
+	UFUNCTION(BlueprintCallable, Category = "Game Time Events")
+	FGameTimerHandle ScheduleGameEvent(float DelayGameHours, FOnGameTimerEvent Event);
+
+	UFUNCTION(BlueprintCallable, Category = "Game Time Events")
+	bool CancelGameTimer(UPARAM(ref) FGameTimerHandle& Handle);
+
+	UFUNCTION(BlueprintPure, Category = "Game Time Events")
+	bool IsGameTimerActive(const FGameTimerHandle& Handle) const;
+
+	// Game seconds until the timer fires, or -1 if it is not active
+	UFUNCTION(BlueprintPure, Category = "Game Time Events")
+	float GetGameTimerRemaining(const FGameTimerHandle& Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "Game Time Events")
+	int32 GetNumGameTimers() const { return GameTimers.Num(); }
+
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Time State")
 	EGameTimeMode CurrentTimeMode;
@@ -117,8 +266,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Time State")
 	EGameTimeMode PreviousTimeMode;
 
+	// Ticks (FGameDateTime::TicksPerSecond) since the start of FGameDateTime::EpochYear
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game Time")
-	FGameDateTime CurrentGameTime;
+	int64 GameTicks;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Game Time")
 	float TotalGameTimeElapsed;
@@ -139,11 +289,47 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Configuration")
 	float MaxOfflineHours;
 
-private:
-	FTimerHandle GameTimeTimer;
-	float AccumulatedTime;
+	// Game seconds covered by one fixed simulation step, per time mode (the smallest chunk in the coarse tier)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+	TMap<EGameTimeMode, float> TimeModeStepSeconds;
 
-	void UpdateGameTime();
+	// Hard cap on steps per frame, regardless of remaining budget
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+	int32 MaxStepsPerFrame;
+
+	// Real milliseconds per frame the simulation may spend catching up
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+	float SimulationBudgetMs;
+
+	// Game seconds the simulation may fall behind before time is slowed down instead
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+	float MaxSimulationBacklogSeconds;
+
+	// Time scale at and above which the simulation switches to the coarse tier
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+	float CoarseTierTimeScaleThreshold;
+
+	// Largest coarse step in game seconds (one game hour); skips and offline catch-up use full steps
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+	float CoarseStepSeconds;
+
+private:
+	// Game seconds accumulated but not yet simulated
+	double PendingSimulationSeconds;
+	double TickRemainder;
+	FGameTimerWheel GameTimers;
+
+	mutable FGameDateTime CachedDateTime;
+	mutable int64 CachedDateTimeTicks;
+	int64 SimulationStepIndex;
+	int32 StepsLastFrame;
+	int32 TimersFiredLastAdvance;
+	bool bSkippingToEvent;
+	bool bSimulationEventRaised;
+
+	void AdvanceClock(int64 Ticks);
+	void RunFixedSteps();
+	void SimulateCoarse(double Seconds);
 	void InitializeTimeScales();
 	void BroadcastTimeEvents();
 